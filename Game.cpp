@@ -1,47 +1,235 @@
 #include "Game.hpp"
 
 #include "gl_errors.hpp" //helper for dumpping OpenGL error messages
-#include "read_chunk.hpp" //helper for reading a vector of structures from a file
+#include "gl_extensions.hpp" //helper for runtime extension queries
+#include "blob_file.hpp" //helper for mapping a chunked blob file into memory
 #include "data_path.hpp" //helper to get paths relative to executable
+#include "mesh_registry.hpp" //zero-allocation name -> mesh index
+#include "startup_profiler.hpp" //launch-time phase timers
 
 #include <glm/gtc/type_ptr.hpp>
 
-#include <iostream>
 #include <fstream>
-#include <map>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <algorithm>
 #include <cstddef>
-#include <random>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+
+#include <sys/stat.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+//Write one cell's object-to-world matrix: 'scaled_rotation' (the shared
+// per-mesh rotation with the draw scale folded into its columns) with the
+// translation column replaced by (tx, ty, 0, 1). Folding the scale ahead of
+// time turns the per-cell mat4-by-mat4 multiply into three column copies plus
+// one column store, which the SSE path does as four 16-byte moves:
+static inline void store_cell_transform(glm::mat4 *dst, glm::mat4 const &scaled_rotation, float tx, float ty) {
+	#ifdef __SSE2__
+	float const *src = glm::value_ptr(scaled_rotation);
+	float *out = glm::value_ptr(*dst);
+	_mm_storeu_ps(out +  0, _mm_loadu_ps(src + 0));
+	_mm_storeu_ps(out +  4, _mm_loadu_ps(src + 4));
+	_mm_storeu_ps(out +  8, _mm_loadu_ps(src + 8));
+	_mm_storeu_ps(out + 12, _mm_set_ps(1.0f, 0.0f, ty, tx)); //note: _mm_set_ps takes lanes high-to-low
+	#else
+	*dst = scaled_rotation;
+	(*dst)[3] = glm::vec4(tx, ty, 0.0f, 1.0f);
+	#endif
+}
 
 //helper defined later; throws if shader compilation fails:
 static GLuint compile_shader(GLenum type, std::string const &source);
 
-Game::Game() {
+//helper defined later; fills a pre-sized buffer in fixed-size slices:
+static void upload_in_slices(GLenum target, size_t size, void const *data, GLenum usage);
+
+//helpers defined later; support the meshes.blob hot-reload diff:
+static int64_t file_mtime(std::string const &path);
+static uint64_t hash_bytes(void const *data, size_t size);
+
+//helpers defined later; cache linked program binaries across launches:
+static bool program_binary_supported();
+static std::string program_binary_cache_path(std::string const &name);
+static bool try_load_program_binary(GLuint program, std::string const &name);
+static void store_program_binary(GLuint program, std::string const &name);
+
+Game::Game(bool headless_, uint32_t seed) : headless(headless_), state(seed) {
+	//per-mesh draw scales (board cell values index these via mesh_array):
+    sizes[0] = 1.2f;
+    sizes[1] = .3f;
+    sizes[2] = 3.0f;
+
+	if (!headless) {
+		init_graphics();
+	}
+}
+
+void Game::update(float, InputSnapshot const &input) {
+	state.step(input);
+}
+
+void Game::make_snapshot(DrawSnapshot *snapshot) const {
+	state.snapshot(snapshot);
+}
+
+//----- meshes.blob layout (shared by first load and hot reload) -----
+
+struct Vertex {
+	glm::vec3 Position;
+	glm::vec3 Normal;
+	glm::u8vec4 Color;
+};
+static_assert(sizeof(Vertex) == 28, "Vertex should be packed.");
+
+//the quantized alternative ('dat1' chunks, written by export-meshes.py
+// --quantized): positions as unorm16 against the chunk's bounds header,
+// normals packed 2_10_10_10 -- 16 bytes of fetch per vertex instead of 28:
+struct PackedVertex {
+	uint16_t Position[3];
+	uint16_t Pad; //keeps Normal 4-byte aligned
+	uint32_t Normal; //GL_INT_2_10_10_10_REV
+	glm::u8vec4 Color;
+};
+static_assert(sizeof(PackedVertex) == 16, "PackedVertex should be packed.");
+
+//position bounds at the head of a 'dat1' chunk; the dequantization
+// scale/bias the vertex shader applies comes from these:
+struct QuantBounds {
+	float min[3];
+	float max[3];
+};
+static_assert(sizeof(QuantBounds) == 24, "QuantBounds should be packed.");
+
+struct IndexEntry {
+	uint32_t name_begin;
+	uint32_t name_end;
+	uint32_t vertex_begin;
+	uint32_t vertex_end;
+};
+static_assert(sizeof(IndexEntry) == 16, "IndexEntry should be packed.");
+
+void Game::init_graphics() {
+	//parsed, validated view of the mesh blob (all pointers point into 'file'):
+	struct BlobContents {
+		std::unique_ptr< BlobFile > file;
+		Vertex const *vertices = nullptr; //('dat0' blobs)
+		PackedVertex const *packed = nullptr; //('dat1' blobs)
+		QuantBounds bounds = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+		uint32_t vertex_count = 0;
+		uint32_t const *elements = nullptr;
+		uint32_t element_count = 0;
+		char const *names = nullptr;
+		uint32_t names_count = 0;
+		IndexEntry const *index_entries = nullptr;
+		uint32_t entry_count = 0;
+	} blob;
+
+	//kick off reading + validating the blob on a worker thread, so the file
+	// I/O overlaps the shader compilation and linking below and startup cost
+	// approaches max(I/O, GL init) instead of their sum; GL upload still
+	// happens on this (the GL) thread, after the join:
+	std::exception_ptr load_error;
+	std::thread load_thread([&blob, &load_error](){
+		StartupPhase phase("blob read+validate");
+		try {
+			//The blob will be made up of three chunks (four, when indexed):
+			// the first chunk will be vertex data (interleaved position/normal/color;
+			//  float 'dat0' or quantized 'dat1', depending on export flags)
+			// an optional chunk will be element indices (for blobs exported with --indexed)
+			// the second chunk will be characters
+			// the third chunk will be an index, mapping a name (range of characters) to a mesh (range of vertex data)
+			blob.file.reset(new BlobFile(data_path("meshes.blob")));
+
+			if (blob.file->peek_chunk("dat0")) {
+				blob.vertices = blob.file->read_chunk< Vertex >("dat0", &blob.vertex_count);
+			} else {
+				//quantized format: bounds header, then packed vertices:
+				uint32_t byte_count = 0;
+				uint8_t const *raw = blob.file->read_chunk< uint8_t >("dat1", &byte_count);
+				if (byte_count < sizeof(QuantBounds)
+				 || (byte_count - sizeof(QuantBounds)) % sizeof(PackedVertex) != 0) {
+					throw std::runtime_error("malformed dat1 chunk.");
+				}
+				memcpy(&blob.bounds, raw, sizeof(QuantBounds)); //(may not be 4-byte aligned)
+				blob.packed = reinterpret_cast< PackedVertex const * >(raw + sizeof(QuantBounds));
+				blob.vertex_count = uint32_t((byte_count - sizeof(QuantBounds)) / sizeof(PackedVertex));
+			}
+
+			if (blob.file->peek_chunk("eidx")) {
+				blob.elements = blob.file->read_chunk< uint32_t >("eidx", &blob.element_count);
+				for (uint32_t i = 0; i < blob.element_count; ++i) {
+					if (blob.elements[i] >= blob.vertex_count) {
+						throw std::runtime_error("element index out of range.");
+					}
+				}
+			}
+
+			blob.names = blob.file->read_chunk< char >("str0", &blob.names_count);
+			blob.index_entries = blob.file->read_chunk< IndexEntry >("idx0", &blob.entry_count);
+
+			if (!blob.file->at_end()) {
+				std::cerr << "WARNING: trailing data in meshes file." << std::endl;
+			}
+		} catch (...) {
+			load_error = std::current_exception();
+		}
+	});
+
+	try { //(if GL init throws, the loader thread must still be joined)
+
 	{ //create an opengl program to perform sun/sky (well, directional+hemispherical) lighting:
+		StartupPhase phase("shader compile+link");
+		simple_shading.program = glCreateProgram();
+
+		//try to reuse a program binary cached by a previous launch (keyed on
+		// driver identity, so a driver update or GPU swap misses cleanly; the
+		// '-v2' suffix is bumped whenever the shader source changes, so stale
+		// binaries from older builds miss too); on a miss, compile from source
+		// and refill the cache:
+		if (!try_load_program_binary(simple_shading.program, "simple_shading-v2")) {
 		GLuint vertex_shader = compile_shader(GL_VERTEX_SHADER,
 			"#version 330\n"
-			"uniform mat4 object_to_clip;\n"
-			"uniform mat4x3 object_to_light;\n"
-			"uniform mat3 normal_to_light;\n"
+			"layout(std140) uniform Camera {\n"
+			"	mat4 world_to_clip;\n"
+			"};\n"
+			//dequantization constants for 'dat1' blobs (identity for float
+			// blobs); set once at init, since the bounds are per-chunk:
+			"uniform vec3 position_scale;\n"
+			"uniform vec3 position_bias;\n"
 			"layout(location=0) in vec4 Position;\n" //note: layout keyword used to make sure that the location-0 attribute is always bound to something
 			"in vec3 Normal;\n"
 			"in vec4 Color;\n"
+			"in mat4 Transform;\n" //per-instance object-to-world transform (uses four attribute locations)
 			"out vec3 position;\n"
 			"out vec3 normal;\n"
 			"out vec4 color;\n"
 			"void main() {\n"
-			"	gl_Position = object_to_clip * Position;\n"
-			"	position = object_to_light * Position;\n"
-			"	normal = normal_to_light * Normal;\n"
+			"	vec4 world = Transform * vec4(Position.xyz * position_scale + position_bias, 1.0);\n"
+			"	gl_Position = world_to_clip * world;\n"
+			"	position = world.xyz;\n"
+			//NOTE: mat3(Transform) is only correct for rotations + uniform scales,
+			// which is all this game uses; the fragment shader re-normalizes anyway:
+			"	normal = mat3(Transform) * Normal;\n"
 			"	color = Color;\n"
 			"}\n"
 		);
 
 		GLuint fragment_shader = compile_shader(GL_FRAGMENT_SHADER,
 			"#version 330\n"
-			"uniform vec3 sun_direction;\n"
-			"uniform vec3 sun_color;\n"
-			"uniform vec3 sky_direction;\n"
-			"uniform vec3 sky_color;\n"
+			//directions/colors are padded to vec4 to keep std140 layout simple:
+			"layout(std140) uniform Lighting {\n"
+			"	vec4 sun_direction;\n"
+			"	vec4 sun_color;\n"
+			"	vec4 sky_direction;\n"
+			"	vec4 sky_color;\n"
+			"};\n"
 			"in vec3 position;\n"
 			"in vec3 normal;\n"
 			"in vec4 color;\n"
@@ -50,26 +238,30 @@ Game::Game() {
 			"	vec3 total_light = vec3(0.0, 0.0, 0.0);\n"
 			"	vec3 n = normalize(normal);\n"
 			"	{ //sky (hemisphere) light:\n"
-			"		vec3 l = sky_direction;\n"
+			"		vec3 l = sky_direction.xyz;\n"
 			"		float nl = 0.5 + 0.5 * dot(n,l);\n"
-			"		total_light += nl * sky_color;\n"
+			"		total_light += nl * sky_color.rgb;\n"
 			"	}\n"
 			"	{ //sun (directional) light:\n"
-			"		vec3 l = sun_direction;\n"
+			"		vec3 l = sun_direction.xyz;\n"
 			"		float nl = max(0.0, dot(n,l));\n"
-			"		total_light += nl * sun_color;\n"
+			"		total_light += nl * sun_color.rgb;\n"
 			"	}\n"
 			"	fragColor = vec4(color.rgb * total_light, color.a);\n"
 			"}\n"
 		);
 
-		simple_shading.program = glCreateProgram();
 		glAttachShader(simple_shading.program, vertex_shader);
 		glAttachShader(simple_shading.program, fragment_shader);
 		//shaders are reference counted so this makes sure they are freed after program is deleted:
 		glDeleteShader(vertex_shader);
 		glDeleteShader(fragment_shader);
 
+		//ask the driver to keep a retrievable binary around for the cache:
+		if (program_binary_supported()) {
+			glProgramParameteri(simple_shading.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+		}
+
 		//link the shader program and throw errors if linking fails:
 		glLinkProgram(simple_shading.program);
 		GLint link_status = GL_FALSE;
@@ -84,352 +276,659 @@ Game::Game() {
 			std::cerr << "Info log: " << std::string(info_log.begin(), info_log.begin() + length);
 			throw std::runtime_error("failed to link program");
 		}
-	}
 
-	{ //read back uniform and attribute locations from the shader program:
-		simple_shading.object_to_clip_mat4 = glGetUniformLocation(simple_shading.program, "object_to_clip");
-		simple_shading.object_to_light_mat4x3 = glGetUniformLocation(simple_shading.program, "object_to_light");
-		simple_shading.normal_to_light_mat3 = glGetUniformLocation(simple_shading.program, "normal_to_light");
+		store_program_binary(simple_shading.program, "simple_shading-v2");
+		} //end of cache-miss path
+	}
 
-		simple_shading.sun_direction_vec3 = glGetUniformLocation(simple_shading.program, "sun_direction");
-		simple_shading.sun_color_vec3 = glGetUniformLocation(simple_shading.program, "sun_color");
-		simple_shading.sky_direction_vec3 = glGetUniformLocation(simple_shading.program, "sky_direction");
-		simple_shading.sky_color_vec3 = glGetUniformLocation(simple_shading.program, "sky_color");
+	{ //read back uniform block and attribute locations from the shader program:
+		simple_shading.Camera_block = glGetUniformBlockIndex(simple_shading.program, "Camera");
+		simple_shading.Lighting_block = glGetUniformBlockIndex(simple_shading.program, "Lighting");
 
 		simple_shading.Position_vec4 = glGetAttribLocation(simple_shading.program, "Position");
 		simple_shading.Normal_vec3 = glGetAttribLocation(simple_shading.program, "Normal");
 		simple_shading.Color_vec4 = glGetAttribLocation(simple_shading.program, "Color");
+		simple_shading.Transform_mat4 = glGetAttribLocation(simple_shading.program, "Transform");
+
+		simple_shading.position_scale_vec3 = glGetUniformLocation(simple_shading.program, "position_scale");
+		simple_shading.position_bias_vec3 = glGetUniformLocation(simple_shading.program, "position_bias");
 	}
 
-	struct Vertex {
-		glm::vec3 Position;
-		glm::vec3 Normal;
-		glm::u8vec4 Color;
-	};
-	static_assert(sizeof(Vertex) == 28, "Vertex should be packed.");
-
-	{ //load mesh data from a binary blob:
-		std::ifstream blob(data_path("meshes.blob"), std::ios::binary);
-		//The blob will be made up of three chunks:
-		// the first chunk will be vertex data (interleaved position/normal/color)
-		// the second chunk will be characters
-		// the third chunk will be an index, mapping a name (range of characters) to a mesh (range of vertex data)
-
-		//read vertex data:
-		std::vector< Vertex > vertices;
-		read_chunk(blob, "dat0", &vertices);
-
-		//read character data (for names):
-		std::vector< char > names;
-		read_chunk(blob, "str0", &names);
-
-		//read index:
-		struct IndexEntry {
-			uint32_t name_begin;
-			uint32_t name_end;
-			uint32_t vertex_begin;
-			uint32_t vertex_end;
-		};
-		static_assert(sizeof(IndexEntry) == 16, "IndexEntry should be packed.");
+	{ //create uniform buffers for constant lighting state (uploaded exactly once,
+	  // here) and camera state (updated by draw() when the window size changes):
+		StartupPhase phase("uniform buffers");
+		if (simple_shading.Camera_block != GL_INVALID_INDEX) {
+			glUniformBlockBinding(simple_shading.program, simple_shading.Camera_block, CameraBinding);
+		}
+		if (simple_shading.Lighting_block != GL_INVALID_INDEX) {
+			glUniformBlockBinding(simple_shading.program, simple_shading.Lighting_block, LightingBinding);
+		}
+
+		glGenBuffers(1, &camera_ubo);
+		glBindBuffer(GL_UNIFORM_BUFFER, camera_ubo);
+		glBufferData(GL_UNIFORM_BUFFER, sizeof(glm::mat4), nullptr, GL_STREAM_DRAW);
+		glBindBufferBase(GL_UNIFORM_BUFFER, CameraBinding, camera_ubo);
+
+		//mirror of the std140 'Lighting' block in the fragment shader:
+		struct LightingBlock {
+			glm::vec4 sun_direction;
+			glm::vec4 sun_color;
+			glm::vec4 sky_direction;
+			glm::vec4 sky_color;
+		} lighting;
+		static_assert(sizeof(LightingBlock) == 64, "LightingBlock should match std140 layout.");
+		lighting.sun_direction = glm::vec4(glm::normalize(glm::vec3(-0.2f, 0.2f, 1.0f)), 0.0f);
+		lighting.sun_color = glm::vec4(0.81f, 0.81f, 0.76f, 1.0f);
+		lighting.sky_direction = glm::vec4(0.0f, 1.0f, 0.0f, 0.0f);
+		lighting.sky_color = glm::vec4(0.2f, 0.2f, 0.3f, 1.0f);
+
+		glGenBuffers(1, &lighting_ubo);
+		glBindBuffer(GL_UNIFORM_BUFFER, lighting_ubo);
+		glBufferData(GL_UNIFORM_BUFFER, sizeof(lighting), &lighting, GL_STATIC_DRAW);
+		glBindBufferBase(GL_UNIFORM_BUFFER, LightingBinding, lighting_ubo);
 
-		std::vector< IndexEntry > index_entries;
-		read_chunk(blob, "idx0", &index_entries);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	}
+
+	} catch (...) {
+		load_thread.join();
+		throw;
+	}
 
-		if (blob.peek() != EOF) {
-			std::cerr << "WARNING: trailing data in meshes file." << std::endl;
+	{ //wait for the blob; the GL init above typically hides most of the read
+	  // (a long 'blob wait' in the startup report means it didn't):
+		StartupPhase phase("blob wait");
+		load_thread.join();
+	}
+	if (load_error) {
+		std::rethrow_exception(load_error);
+	}
+
+	meshes_indexed = (blob.elements != nullptr);
+
+	//ranges in the index refer to elements when an 'eidx' chunk is present:
+	uint32_t range_limit = meshes_indexed ? blob.element_count : blob.vertex_count;
+
+	//index the names on a worker thread -- it only reads the mapped chunks, so
+	// it runs concurrently with the GPU uploads below and its cost disappears
+	// behind them:
+	MeshRegistry registry;
+	std::exception_ptr index_error;
+	std::thread index_thread([&blob, &registry, &index_error, range_limit](){
+		StartupPhase phase("mesh name index");
+		try {
+			//views straight into the mapped str0 chunk -- no per-name
+			// allocation, which matters for blobs with thousands of meshes:
+			registry.reserve(blob.entry_count);
+			for (uint32_t i = 0; i < blob.entry_count; ++i) {
+				IndexEntry e; //copied out, since the chunk may not be 4-byte aligned:
+				memcpy(&e, blob.index_entries + i, sizeof(e));
+				if (e.name_begin > e.name_end || e.name_end > blob.names_count) {
+					throw std::runtime_error("invalid name indices in index.");
+				}
+				if (e.vertex_begin > e.vertex_end || e.vertex_end > range_limit) {
+					throw std::runtime_error("invalid vertex indices in index.");
+				}
+				registry.add(
+					std::string_view(blob.names + e.name_begin, e.name_end - e.name_begin),
+					e.vertex_begin, e.vertex_end - e.vertex_begin);
+			}
+			registry.finish();
+		} catch (...) {
+			index_error = std::current_exception();
 		}
+	});
+
+	try { //(if upload throws, the index thread must still be joined)
 
-		//upload vertex data to the graphics card:
+	{ //upload vertex (and element) data to the graphics card, directly from the mapping:
+		StartupPhase phase("vertex/element upload");
 		glGenBuffers(1, &meshes_vbo);
 		glBindBuffer(GL_ARRAY_BUFFER, meshes_vbo);
-		glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * vertices.size(), vertices.data(), GL_STATIC_DRAW);
+		if (blob.packed) {
+			upload_in_slices(GL_ARRAY_BUFFER, sizeof(PackedVertex) * blob.vertex_count, blob.packed, GL_STATIC_DRAW);
+		} else {
+			upload_in_slices(GL_ARRAY_BUFFER, sizeof(Vertex) * blob.vertex_count, blob.vertices, GL_STATIC_DRAW);
+		}
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
 
-		//create map to store index entries:
-		std::map< std::string, Mesh > index;
-		for (IndexEntry const &e : index_entries) {
-			if (e.name_begin > e.name_end || e.name_end > names.size()) {
-				throw std::runtime_error("invalid name indices in index.");
-			}
-			if (e.vertex_begin > e.vertex_end || e.vertex_end > vertices.size()) {
-				throw std::runtime_error("invalid vertex indices in index.");
+		//tell the vertex shader how to undo the quantization (unorm16 reads
+		// back as [0,1], so position = read * extent + min); float blobs pass
+		// positions through unchanged:
+		if (blob.packed) {
+			float extent[3];
+			for (uint32_t c = 0; c < 3; ++c) {
+				extent[c] = blob.bounds.max[c] - blob.bounds.min[c];
+				if (!(extent[c] > 0.0f)) extent[c] = 1.0f; //matches the exporter's degenerate-axis guard
 			}
+			position_scale_value = glm::vec3(extent[0], extent[1], extent[2]);
+			position_bias_value = glm::vec3(blob.bounds.min[0], blob.bounds.min[1], blob.bounds.min[2]);
+		} else {
+			position_scale_value = glm::vec3(1.0f, 1.0f, 1.0f);
+			position_bias_value = glm::vec3(0.0f, 0.0f, 0.0f);
+		}
+		glUseProgram(simple_shading.program);
+		glUniform3f(simple_shading.position_scale_vec3, position_scale_value.x, position_scale_value.y, position_scale_value.z);
+		glUniform3f(simple_shading.position_bias_vec3, position_bias_value.x, position_bias_value.y, position_bias_value.z);
+		glUseProgram(0);
+
+		if (meshes_indexed) {
+			glGenBuffers(1, &meshes_ebo);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshes_ebo);
+			upload_in_slices(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32_t) * blob.element_count, blob.elements, GL_STATIC_DRAW);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+		}
+	}
+
+	} catch (...) {
+		index_thread.join();
+		throw;
+	}
+
+	index_thread.join();
+	if (index_error) {
+		std::rethrow_exception(index_error);
+	}
+
+	{ //resolve the game's meshes against the (now finished) name index:
+		//the game's mesh names are known at compile time, so their handles are too:
+		auto lookup = [&registry](MeshHandle handle, std::string_view name) -> Mesh {
+			MeshRegistry::Entry const &entry = registry.lookup(handle, name);
 			Mesh mesh;
-			mesh.first = e.vertex_begin;
-			mesh.count = e.vertex_end - e.vertex_begin;
-			auto ret = index.insert(std::make_pair(
-				std::string(names.begin() + e.name_begin, names.begin() + e.name_end),
-				mesh));
-			if (!ret.second) {
-				throw std::runtime_error("duplicate name in index.");
+			mesh.first = GLint(entry.first);
+			mesh.count = GLsizei(entry.count);
+			return mesh;
+		};
+		tile_mesh = lookup(mesh_name_hash("Plane"), "Plane");
+		ship_mesh = lookup(mesh_name_hash("Ship"), "Ship");
+		star_mesh = lookup(mesh_name_hash("Star"), "Star");
+		brick_mesh = lookup(mesh_name_hash("Brick"), "Brick");
+
+		//board cell values index into mesh_array:
+		mesh_array[0] = ship_mesh;
+		mesh_array[1] = star_mesh;
+		mesh_array[2] = brick_mesh;
+
+		{ //remember what was uploaded, so poll_reload() can diff re-exports against it:
+			meshes_blob_mtime = file_mtime(data_path("meshes.blob"));
+			next_reload_check = std::chrono::steady_clock::now();
+			meshes_quantized = (blob.packed != nullptr);
+			uint8_t const *vertex_bytes = meshes_quantized
+				? reinterpret_cast< uint8_t const * >(blob.packed)
+				: reinterpret_cast< uint8_t const * >(blob.vertices);
+			size_t stride = meshes_quantized ? sizeof(PackedVertex) : sizeof(Vertex);
+			meshes_vbo_bytes = stride * blob.vertex_count;
+			meshes_ebo_bytes = sizeof(uint32_t) * blob.element_count;
+			vertex_data_hash = hash_bytes(vertex_bytes, meshes_vbo_bytes);
+			reload_entries.clear();
+			reload_entries.reserve(registry.entries.size());
+			for (auto const &entry : registry.entries) {
+				ReloadEntry r;
+				r.name = std::string(entry.name);
+				r.first = entry.first;
+				r.count = entry.count;
+				if (meshes_indexed) {
+					r.hash = hash_bytes(blob.elements + entry.first, sizeof(uint32_t) * entry.count);
+				} else {
+					r.hash = hash_bytes(vertex_bytes + stride * entry.first, stride * entry.count);
+				}
+				reload_entries.emplace_back(std::move(r));
 			}
 		}
+	}
 
-		//look up into index map to extract meshes:
-		auto lookup = [&index](std::string const &name) -> Mesh {
-			auto f = index.find(name);
-			if (f == index.end()) {
-				throw std::runtime_error("Mesh named '" + name + "' does not appear in index.");
-			}
-			return f->second;
-		};
-		tile_mesh = lookup("Plane");
-		ship_mesh = lookup("Ship");
-		star_mesh = lookup("Star");
-		brick_mesh = lookup("Brick");
+	StartupPhase vao_phase("instance stream + vao");
+
+	{ //create a streaming buffer for the per-instance transforms that draw() re-fills every frame:
+		//each of the four buckets gets enough room for a full board plus some hud slack:
+		instance_capacity = GameBoard::Width * GameBoard::Height + 128;
+		instance_stream.create(4 * instance_capacity * sizeof(glm::mat4));
 	}
 
 	{ //create vertex array object to hold the map from the mesh vertex buffer to shader program attributes:
 		glGenVertexArrays(1, &meshes_for_simple_shading_vao);
 		glBindVertexArray(meshes_for_simple_shading_vao);
 		glBindBuffer(GL_ARRAY_BUFFER, meshes_vbo);
-		//note that I'm specifying a 3-vector for a 4-vector attribute here, and this is okay to do:
-		glVertexAttribPointer(simple_shading.Position_vec4, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, Position));
+		//attribute formats follow the chunk version the blob carried:
+		if (blob.packed) {
+			//note: the unorm16 position reads back in [0,1]; the shader's
+			// dequantization uniforms (set above) restore the original range:
+			glVertexAttribPointer(simple_shading.Position_vec4, 3, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(PackedVertex), (GLbyte *)0 + offsetof(PackedVertex, Position));
+			glEnableVertexAttribArray(simple_shading.Position_vec4);
+			if (simple_shading.Normal_vec3 != -1U) {
+				//(size must be 4 for packed types; the vec3 attribute takes xyz)
+				glVertexAttribPointer(simple_shading.Normal_vec3, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(PackedVertex), (GLbyte *)0 + offsetof(PackedVertex, Normal));
+				glEnableVertexAttribArray(simple_shading.Normal_vec3);
+			}
+			if (simple_shading.Color_vec4 != -1U) {
+				glVertexAttribPointer(simple_shading.Color_vec4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(PackedVertex), (GLbyte *)0 + offsetof(PackedVertex, Color));
+				glEnableVertexAttribArray(simple_shading.Color_vec4);
+			}
+		} else {
+			//note that I'm specifying a 3-vector for a 4-vector attribute here, and this is okay to do:
+			glVertexAttribPointer(simple_shading.Position_vec4, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, Position));
+			glEnableVertexAttribArray(simple_shading.Position_vec4);
+			if (simple_shading.Normal_vec3 != -1U) {
+				glVertexAttribPointer(simple_shading.Normal_vec3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, Normal));
+				glEnableVertexAttribArray(simple_shading.Normal_vec3);
+			}
+			if (simple_shading.Color_vec4 != -1U) {
+				glVertexAttribPointer(simple_shading.Color_vec4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, Color));
+				glEnableVertexAttribArray(simple_shading.Color_vec4);
+			}
+		}
+
+		//per-instance transforms come from the streaming buffer; draw()
+		// re-points the attributes at the active ring region every frame:
+		if (simple_shading.Transform_mat4 != -1U) {
+			glBindBuffer(GL_ARRAY_BUFFER, instance_stream.buffer);
+			//a mat4 attribute takes four consecutive locations, one per column:
+			for (uint32_t col = 0; col < 4; ++col) {
+				glVertexAttribPointer(simple_shading.Transform_mat4 + col, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (GLbyte *)0 + col * sizeof(glm::vec4));
+				glEnableVertexAttribArray(simple_shading.Transform_mat4 + col);
+				glVertexAttribDivisor(simple_shading.Transform_mat4 + col, 1); //advance per instance, not per vertex
+			}
+		}
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		//the element buffer binding is part of vertex array state, so capture it here:
+		if (meshes_indexed) {
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshes_ebo);
+		}
+		glBindVertexArray(0);
+	}
+
+	{ //dynamic geometry channel: a streaming buffer + VAO of its own, so
+	  // overlay/debug geometry never orphans or rewrites the static meshes_vbo:
+		dynamic_capacity = 4096;
+		dynamic_stream.create(dynamic_capacity * sizeof(DynamicVertex));
+
+		glGenVertexArrays(1, &dynamic_vao);
+		glBindVertexArray(dynamic_vao);
+		glBindBuffer(GL_ARRAY_BUFFER, dynamic_stream.buffer);
+		//same attributes the float mesh layout feeds; draw_dynamic re-points
+		// them at the active ring region every call:
+		glVertexAttribPointer(simple_shading.Position_vec4, 3, GL_FLOAT, GL_FALSE, sizeof(DynamicVertex), (GLbyte *)0 + offsetof(DynamicVertex, Position));
 		glEnableVertexAttribArray(simple_shading.Position_vec4);
 		if (simple_shading.Normal_vec3 != -1U) {
-			glVertexAttribPointer(simple_shading.Normal_vec3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, Normal));
+			glVertexAttribPointer(simple_shading.Normal_vec3, 3, GL_FLOAT, GL_FALSE, sizeof(DynamicVertex), (GLbyte *)0 + offsetof(DynamicVertex, Normal));
 			glEnableVertexAttribArray(simple_shading.Normal_vec3);
 		}
 		if (simple_shading.Color_vec4 != -1U) {
-			glVertexAttribPointer(simple_shading.Color_vec4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, Color));
+			glVertexAttribPointer(simple_shading.Color_vec4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(DynamicVertex), (GLbyte *)0 + offsetof(DynamicVertex, Color));
 			glEnableVertexAttribArray(simple_shading.Color_vec4);
 		}
+		//the Transform attribute stays a non-array ("current") attribute in
+		// this VAO; draw_dynamic sets it to the identity, so dynamic vertices
+		// are taken as already being in world space:
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		glBindVertexArray(0);
 	}
 
 	GL_ERRORS();
-
-	//----------------
-	//set up game board with meshes and rolls:
-	std::mt19937 mt(0xbead1234);
-
-    
-    /* initialize random seed: */
-    srand (time(NULL));
-    
-	std::vector< Mesh const * > meshes{&brick_mesh, &star_mesh, &ship_mesh };
-    mesh_array[0] = ship_mesh;
-    mesh_array[1] = star_mesh;
-    mesh_array[2] = brick_mesh;
-    
-    sizes[0] = 1.2f;
-    sizes[1] = .3f;
-    sizes[2] = 3.0f;
-    
-    
-	for (uint32_t i = 0; i < board_size.x; ++i) {
-        for(uint32_t j = 0; j < board_size.y; ++j){
-            board[i][j] = -1;
-        }
-	}
-    
-    ship_x = 4;
-    ship_y = 0;
-    
-    board[4][0] = 0;
-    
-    //fill in board
-    for(uint32_t i = 2; i < board_size.y; i++){
-        int blocks = rand()%3+1;
-        int stars = rand()%2;
-        int num;
-        for(uint32_t j = 0; j < blocks; j++){
-            do{
-                num = rand() % 9;
-            }while(board[num][i] != -1);
-            board[num][i] = 2;
-        }
-        for(uint32_t j = 0; j < stars; j++){
-            do{
-                num = rand() % 9;
-            }while(board[num][i] != -1);
-            board[num][i] = 1;
-        }
-    }
 }
 
 Game::~Game() {
+	if (headless) return; //no GL resources were created
 	glDeleteVertexArrays(1, &meshes_for_simple_shading_vao);
 	meshes_for_simple_shading_vao = -1U;
 
 	glDeleteBuffers(1, &meshes_vbo);
 	meshes_vbo = -1U;
 
+	if (meshes_ebo != -1U) {
+		glDeleteBuffers(1, &meshes_ebo);
+		meshes_ebo = -1U;
+	}
+
+	instance_stream.destroy();
+
+	glDeleteVertexArrays(1, &dynamic_vao);
+	dynamic_vao = -1U;
+	dynamic_stream.destroy();
+
+	glDeleteBuffers(1, &camera_ubo);
+	camera_ubo = -1U;
+
+	glDeleteBuffers(1, &lighting_ubo);
+	lighting_ubo = -1U;
+
 	glDeleteProgram(simple_shading.program);
 	simple_shading.program = -1U;
 
 	GL_ERRORS();
 }
 
-bool Game::handle_event(SDL_Event const &evt, glm::uvec2 window_size) {
-	//ignore any keys that are the result of automatic key repeat:
-	if (evt.type == SDL_KEYDOWN && evt.key.repeat) {
-		return false;
+void Game::draw_dynamic(DynamicVertex const *vertices, uint32_t count) {
+	if (count == 0) return;
+	if (count > dynamic_capacity) count = dynamic_capacity; //same drop-the-excess policy as add_instance
+
+	//stream this call's vertices into the ring (waits only if the GPU is
+	// three frames behind, like the instance stream):
+	DynamicVertex *region = reinterpret_cast< DynamicVertex * >(dynamic_stream.begin_frame());
+	memcpy(region, vertices, sizeof(DynamicVertex) * count);
+	dynamic_stream.flush();
+
+	glBindVertexArray(dynamic_vao);
+	glUseProgram(simple_shading.program);
+
+	//dynamic vertices are plain world-space floats; bypass the blob's
+	// position dequantization for this draw:
+	glUniform3f(simple_shading.position_scale_vec3, 1.0f, 1.0f, 1.0f);
+	glUniform3f(simple_shading.position_bias_vec3, 0.0f, 0.0f, 0.0f);
+
+	//identity object-to-world through the current-value attributes (the
+	// Transform arrays are disabled in dynamic_vao):
+	if (simple_shading.Transform_mat4 != -1U) {
+		glVertexAttrib4f(simple_shading.Transform_mat4 + 0, 1.0f, 0.0f, 0.0f, 0.0f);
+		glVertexAttrib4f(simple_shading.Transform_mat4 + 1, 0.0f, 1.0f, 0.0f, 0.0f);
+		glVertexAttrib4f(simple_shading.Transform_mat4 + 2, 0.0f, 0.0f, 1.0f, 0.0f);
+		glVertexAttrib4f(simple_shading.Transform_mat4 + 3, 0.0f, 0.0f, 0.0f, 1.0f);
+	}
+
+	//point the attributes at the region just written and draw:
+	glBindBuffer(GL_ARRAY_BUFFER, dynamic_stream.buffer);
+	size_t base = dynamic_stream.offset();
+	glVertexAttribPointer(simple_shading.Position_vec4, 3, GL_FLOAT, GL_FALSE, sizeof(DynamicVertex), (GLbyte *)0 + base + offsetof(DynamicVertex, Position));
+	if (simple_shading.Normal_vec3 != -1U) {
+		glVertexAttribPointer(simple_shading.Normal_vec3, 3, GL_FLOAT, GL_FALSE, sizeof(DynamicVertex), (GLbyte *)0 + base + offsetof(DynamicVertex, Normal));
 	}
-	//handle tracking the state of WSAD for roll control:
-	if (evt.type == SDL_KEYDOWN || evt.type == SDL_KEYUP) {
-		if (evt.key.keysym.scancode == SDL_SCANCODE_LEFT) {
-			controls.left = (evt.type == SDL_KEYDOWN);
-			return true;
-		} else if (evt.key.keysym.scancode == SDL_SCANCODE_RIGHT) {
-			controls.right = (evt.type == SDL_KEYDOWN);
-			return true;
+	if (simple_shading.Color_vec4 != -1U) {
+		glVertexAttribPointer(simple_shading.Color_vec4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(DynamicVertex), (GLbyte *)0 + base + offsetof(DynamicVertex, Color));
+	}
+	glDrawArrays(GL_TRIANGLES, 0, GLsizei(count));
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	//restore the dequantization for subsequent mesh draws:
+	glUniform3f(simple_shading.position_scale_vec3, position_scale_value.x, position_scale_value.y, position_scale_value.z);
+	glUniform3f(simple_shading.position_bias_vec3, position_bias_value.x, position_bias_value.y, position_bias_value.z);
+
+	glUseProgram(0);
+	glBindVertexArray(0);
+
+	dynamic_stream.end_frame();
+
+	GL_ERRORS();
+}
+
+void Game::poll_reload() {
+	if (headless) return;
+
+	//mtime polls are cheap but not free; a couple per second is plenty:
+	auto now = std::chrono::steady_clock::now();
+	if (now < next_reload_check) return;
+	next_reload_check = now + std::chrono::milliseconds(500);
+
+	std::string path = data_path("meshes.blob");
+	int64_t mtime = file_mtime(path);
+	if (mtime == 0 || mtime == meshes_blob_mtime) return;
+
+	try {
+		//map and validate the re-exported blob (same layout as init_graphics):
+		BlobFile file(path);
+
+		bool quantized = !file.peek_chunk("dat0");
+		size_t stride = quantized ? sizeof(PackedVertex) : sizeof(Vertex);
+		uint8_t const *vertex_bytes = nullptr;
+		uint32_t vertex_count = 0;
+		QuantBounds bounds = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+		if (quantized) {
+			uint32_t byte_count = 0;
+			uint8_t const *raw = file.read_chunk< uint8_t >("dat1", &byte_count);
+			if (byte_count < sizeof(QuantBounds)
+			 || (byte_count - sizeof(QuantBounds)) % sizeof(PackedVertex) != 0) {
+				throw std::runtime_error("malformed dat1 chunk.");
+			}
+			memcpy(&bounds, raw, sizeof(QuantBounds));
+			vertex_bytes = raw + sizeof(QuantBounds);
+			vertex_count = uint32_t((byte_count - sizeof(QuantBounds)) / sizeof(PackedVertex));
+		} else {
+			uint32_t count = 0;
+			vertex_bytes = reinterpret_cast< uint8_t const * >(file.read_chunk< Vertex >("dat0", &count));
+			vertex_count = count;
+		}
+
+		uint32_t const *elements = nullptr;
+		uint32_t element_count = 0;
+		if (file.peek_chunk("eidx")) {
+			elements = file.read_chunk< uint32_t >("eidx", &element_count);
+			for (uint32_t i = 0; i < element_count; ++i) {
+				if (elements[i] >= vertex_count) throw std::runtime_error("element index out of range.");
+			}
+		}
+
+		uint32_t names_count = 0;
+		char const *names = file.read_chunk< char >("str0", &names_count);
+		uint32_t entry_count = 0;
+		IndexEntry const *index_entries = file.read_chunk< IndexEntry >("idx0", &entry_count);
+
+		if (quantized != meshes_quantized || (elements != nullptr) != meshes_indexed) {
+			//the VAO's attribute formats (or element binding) would have to
+			// change; that path needs a restart, so don't keep retrying:
+			std::cerr << "NOTE: meshes.blob changed chunk layout on disk; restart to pick it up." << std::endl;
+			meshes_blob_mtime = mtime;
+			return;
+		}
+
+		//build the new per-mesh table (and validate) before touching any GL
+		// state, so a bad blob never leaves the live buffers half-patched:
+		uint32_t range_limit = meshes_indexed ? element_count : vertex_count;
+		std::vector< ReloadEntry > fresh;
+		fresh.reserve(entry_count);
+		for (uint32_t i = 0; i < entry_count; ++i) {
+			IndexEntry e; //copied out, since the chunk may not be 4-byte aligned:
+			memcpy(&e, index_entries + i, sizeof(e));
+			if (e.name_begin > e.name_end || e.name_end > names_count) {
+				throw std::runtime_error("invalid name indices in index.");
+			}
+			if (e.vertex_begin > e.vertex_end || e.vertex_end > range_limit) {
+				throw std::runtime_error("invalid vertex indices in index.");
+			}
+			ReloadEntry r;
+			r.name = std::string(names + e.name_begin, e.name_end - e.name_begin);
+			r.first = e.vertex_begin;
+			r.count = e.vertex_end - e.vertex_begin;
+			if (meshes_indexed) {
+				r.hash = hash_bytes(elements + r.first, sizeof(uint32_t) * r.count);
+			} else {
+				r.hash = hash_bytes(vertex_bytes + stride * r.first, stride * r.count);
+			}
+			fresh.emplace_back(std::move(r));
+		}
+
+		//the game's meshes must still exist in the new blob:
+		auto find_fresh = [&fresh](std::string_view name) -> ReloadEntry const & {
+			for (auto const &r : fresh) {
+				if (r.name == name) return r;
+			}
+			throw std::runtime_error("mesh '" + std::string(name) + "' missing from re-exported blob.");
+		};
+		ReloadEntry const &fresh_tile = find_fresh("Plane");
+		ReloadEntry const &fresh_ship = find_fresh("Ship");
+		ReloadEntry const &fresh_star = find_fresh("Star");
+		ReloadEntry const &fresh_brick = find_fresh("Brick");
+
+		auto find_live = [this](std::string const &name) -> ReloadEntry const * {
+			for (auto const &r : reload_entries) {
+				if (r.name == name) return &r;
+			}
+			return nullptr;
+		};
+
+		//patch the vertex buffer:
+		size_t vbo_bytes = stride * vertex_count;
+		uint64_t new_vertex_hash = hash_bytes(vertex_bytes, vbo_bytes);
+		uint32_t patched = 0;
+		glBindBuffer(GL_ARRAY_BUFFER, meshes_vbo);
+		if (meshes_indexed || vbo_bytes != meshes_vbo_bytes) {
+			//indexed entries range over elements (vertices are shared), and a
+			// grown/shrunk pool shifts every range, so diff the pool as a whole:
+			if (vbo_bytes != meshes_vbo_bytes || new_vertex_hash != vertex_data_hash) {
+				upload_in_slices(GL_ARRAY_BUFFER, vbo_bytes, vertex_bytes, GL_STATIC_DRAW);
+				++patched;
+			}
+		} else {
+			//per-mesh diff: re-upload only ranges whose position or bytes changed:
+			for (auto const &r : fresh) {
+				ReloadEntry const *live = find_live(r.name);
+				if (live && live->first == r.first && live->count == r.count && live->hash == r.hash) continue;
+				glBufferSubData(GL_ARRAY_BUFFER, GLintptr(stride * r.first), GLsizeiptr(stride * r.count), vertex_bytes + stride * r.first);
+				++patched;
+			}
 		}
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		//patch the element buffer the same way (bound outside the VAO, so the
+		// VAO's captured binding is untouched):
+		if (meshes_indexed) {
+			glBindVertexArray(0);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshes_ebo);
+			size_t ebo_bytes = sizeof(uint32_t) * element_count;
+			if (ebo_bytes != meshes_ebo_bytes) {
+				upload_in_slices(GL_ELEMENT_ARRAY_BUFFER, ebo_bytes, elements, GL_STATIC_DRAW);
+				++patched;
+			} else {
+				for (auto const &r : fresh) {
+					ReloadEntry const *live = find_live(r.name);
+					if (live && live->first == r.first && live->count == r.count && live->hash == r.hash) continue;
+					glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, GLintptr(sizeof(uint32_t) * r.first), GLsizeiptr(sizeof(uint32_t) * r.count), elements + r.first);
+					++patched;
+				}
+			}
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+			meshes_ebo_bytes = ebo_bytes;
+		}
+
+		//quantization bounds may have moved with the new art:
+		if (quantized) {
+			float extent[3];
+			for (uint32_t c = 0; c < 3; ++c) {
+				extent[c] = bounds.max[c] - bounds.min[c];
+				if (!(extent[c] > 0.0f)) extent[c] = 1.0f;
+			}
+			position_scale_value = glm::vec3(extent[0], extent[1], extent[2]);
+			position_bias_value = glm::vec3(bounds.min[0], bounds.min[1], bounds.min[2]);
+			glUseProgram(simple_shading.program);
+			glUniform3f(simple_shading.position_scale_vec3, position_scale_value.x, position_scale_value.y, position_scale_value.z);
+			glUniform3f(simple_shading.position_bias_vec3, position_bias_value.x, position_bias_value.y, position_bias_value.z);
+			glUseProgram(0);
+		}
+
+		//swap in the new mesh table (Mesh entries update in place; the VAO and
+		// program never changed):
+		auto as_mesh = [](ReloadEntry const &r) -> Mesh {
+			Mesh mesh;
+			mesh.first = GLint(r.first);
+			mesh.count = GLsizei(r.count);
+			return mesh;
+		};
+		tile_mesh = as_mesh(fresh_tile);
+		ship_mesh = as_mesh(fresh_ship);
+		star_mesh = as_mesh(fresh_star);
+		brick_mesh = as_mesh(fresh_brick);
+		mesh_array[0] = ship_mesh;
+		mesh_array[1] = star_mesh;
+		mesh_array[2] = brick_mesh;
+
+		reload_entries = std::move(fresh);
+		meshes_vbo_bytes = vbo_bytes;
+		vertex_data_hash = new_vertex_hash;
+		meshes_blob_mtime = mtime;
+
+		std::cout << "Reloaded meshes.blob (" << patched << " range" << (patched == 1 ? "" : "s") << " re-uploaded)." << std::endl;
+		GL_ERRORS();
+	} catch (std::exception const &e) {
+		//most likely the exporter was caught mid-write; the mtime is left
+		// unchanged, so the next poll retries against the finished file:
+		std::cerr << "NOTE: meshes.blob reload failed (" << e.what() << "); will retry." << std::endl;
 	}
-	
-	return false;
 }
 
-void Game::update(float elapsed) {
-	//if the arrow keys are pressed, move ship and update board
-	//float amt = elapsed * 1.0f;
-    
-    if(game_over == 1){
-        return;
-    }
 
-    if(controls.left == true && ship_x != 0){
-        board[ship_x][ship_y] = -1;
-        ship_x--;
-        board[ship_x][ship_y] = 0;
-        
-        if(board[ship_x][ship_y + 1] == 1){
-            score++;
-        }
-        if(board[ship_x][ship_y + 1] == 2){
-            lives--;
-            if(lives == 0){
-                game_over = 1;
-            }
-        }
-        //move blocks down
-        for(uint32_t j = 2; j < board_size.y; j++){
-            for(uint32_t i = 0; i < board_size.x ; i++){
-                board[i][j-1] = board[i][j];
-            }
-        }
-        int blocks = rand()%3+1;
-        int stars = rand()%2;
-        int num;
-        for(uint32_t j = 0; j < board_size.x; j++){
-            board[j][8] = -1;
-        }
-        for(uint32_t j = 0; j < blocks; j++){
-            do{
-                num = rand() % 9;
-            }while(board[num][8] != -1);
-            board[num][8] = 2;
-        }
-        for(uint32_t j = 0; j < stars; j++){
-            do{
-                num = rand() % 9;
-            }while(board[num][8] != -1);
-            board[num][8] = 1;
-        }
-    }else if(controls.right == true && ship_x != board_size.x - 1){
-        board[ship_x][ship_y] = -1;
-        ship_x++;
-        board[ship_x][ship_y] = 0;
-        
-        if(board[ship_x][ship_y + 1] == 1){
-            score++;
-        }
-        if(board[ship_x][ship_y + 1] == 2){
-            lives--;
-            if(lives == 0){
-                game_over = 1;
-            }
-        }
-        
-        //move blocks down
-        for(uint32_t j = 2; j < board_size.y; j++){
-            for(uint32_t i = 0; i < board_size.x ; i++){
-                board[i][j-1] = board[i][j];
-            }
-        }
-        int blocks = rand()%3+1;
-        int stars = rand()%2;
-        int num;
-        for(uint32_t j = 0; j < board_size.x; j++){
-            board[j][8] = -1;
-        }
-        for(uint32_t j = 0; j < blocks; j++){
-            do{
-                num = rand() % 9;
-            }while(board[num][8] != -1);
-            board[num][8] = 2;
-        }
-        for(uint32_t j = 0; j < stars; j++){
-            do{
-                num = rand() % 9;
-            }while(board[num][8] != -1);
-            board[num][8] = 1;
-        }
-    }
-    
-    if(score == 49){
-        game_over = 1;
-    }
-    
-    controls.left = false;
-    controls.right = false;
+void Game::draw(glm::uvec2 drawable_size, float alpha, FrameArena &arena, DrawSnapshot const &snapshot) {
+	draw(glm::ivec2(0, 0), drawable_size, alpha, arena, snapshot);
 }
 
-void Game::draw(glm::uvec2 drawable_size) {
-	//Set up a transformation matrix to fit the board in the window:
-	glm::mat4 world_to_clip;
-	{
-		float aspect = float(drawable_size.x) / float(drawable_size.y);
+void Game::draw(glm::ivec2 viewport_min, glm::uvec2 viewport_size, float alpha, FrameArena &arena, DrawSnapshot const &snapshot) {
+	//restrict rasterization to this board's rect (the scissor also covers the
+	// thin triangles the viewport transform alone would let bleed past the
+	// edge of a shared window):
+	glViewport(viewport_min.x, viewport_min.y, GLsizei(viewport_size.x), GLsizei(viewport_size.y));
+	glScissor(viewport_min.x, viewport_min.y, GLsizei(viewport_size.x), GLsizei(viewport_size.y));
+	glEnable(GL_SCISSOR_TEST);
 
-		//want scale such that board * scale fits in [-aspect,aspect]x[-1.0,1.0] screen box:
-		float scale = glm::min(
-			2.0f * aspect / float(board_size.x),
-			2.0f / float(board_size.y)
-		);
+	//lighting constants were uploaded once at init, and the camera matrix
+	// depends only on the viewport size, so the camera block is rebuilt and
+	// re-sent only when the size actually changed (never, on most frames --
+	// including split-screen frames, since equal-sized viewports share it):
+	if (viewport_size != camera_uploaded_size) {
+		//Set up a transformation matrix to fit the board in the viewport:
+		glm::mat4 world_to_clip;
+		{
+			float aspect = float(viewport_size.x) / float(viewport_size.y);
 
-		//center of board will be placed at center of screen:
-		glm::vec2 center = 0.5f * glm::vec2(board_size);
+			//want scale such that board * scale fits in [-aspect,aspect]x[-1.0,1.0] screen box:
+			float scale = glm::min(
+				2.0f * aspect / float(GameBoard::Width),
+				2.0f / float(GameBoard::Height)
+			);
 
-		//NOTE: glm matrices are specified in column-major order
-		world_to_clip = glm::mat4(
-			scale / aspect, 0.0f, 0.0f, 0.0f,
-			0.0f, scale, 0.0f, 0.0f,
-			0.0f, 0.0f,-1.0f, 0.0f,
-			-(scale / aspect) * center.x, -scale * center.y, 0.0f, 1.0f
-		);
+			//center of board will be placed at center of screen:
+			glm::vec2 center = 0.5f * glm::vec2(GameBoard::Width, GameBoard::Height);
+
+			//NOTE: glm matrices are specified in column-major order
+			world_to_clip = glm::mat4(
+				scale / aspect, 0.0f, 0.0f, 0.0f,
+				0.0f, scale, 0.0f, 0.0f,
+				0.0f, 0.0f,-1.0f, 0.0f,
+				-(scale / aspect) * center.x, -scale * center.y, 0.0f, 1.0f
+			);
+
+			{ //derive the visible row span from the fit: world y maps to clip
+			  // scale * (y - center.y), so rows outside [center.y - 1/scale,
+			  // center.y + 1/scale] can never reach the viewport. A cell at row
+			  // y spans world [y, y+1], with one extra row of margin for meshes
+			  // that overhang their cell:
+				float y_min = center.y - 1.0f / scale;
+				float y_max = center.y + 1.0f / scale;
+				int begin = int(std::floor(y_min)) - 1;
+				int end = int(std::ceil(y_max)) + 1;
+				if (begin < 0) begin = 0;
+				if (end > int(GameBoard::Height)) end = int(GameBoard::Height);
+				if (end < begin) end = begin;
+				visible_row_begin = uint32_t(begin);
+				visible_row_end = uint32_t(end);
+			}
+		}
+
+		glBindBuffer(GL_UNIFORM_BUFFER, camera_ubo);
+		glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(glm::mat4), glm::value_ptr(world_to_clip));
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+		camera_uploaded_size = viewport_size;
 	}
 
 	//set up graphics pipeline to use data from the meshes and the simple shading program:
 	glBindVertexArray(meshes_for_simple_shading_vao);
 	glUseProgram(simple_shading.program);
 
-	glUniform3fv(simple_shading.sun_color_vec3, 1, glm::value_ptr(glm::vec3(0.81f, 0.81f, 0.76f)));
-	glUniform3fv(simple_shading.sun_direction_vec3, 1, glm::value_ptr(glm::normalize(glm::vec3(-0.2f, 0.2f, 1.0f))));
-	glUniform3fv(simple_shading.sky_color_vec3, 1, glm::value_ptr(glm::vec3(0.2f, 0.2f, 0.3f)));
-	glUniform3fv(simple_shading.sky_direction_vec3, 1, glm::value_ptr(glm::vec3(0.0f, 1.0f, 0.0f)));
-
-	//helper function to draw a given mesh with a given transformation:
-	auto draw_mesh = [&](Mesh const &mesh, glm::mat4 const &object_to_world) {
-		//set up the matrix uniforms:
-		if (simple_shading.object_to_clip_mat4 != -1U) {
-			glm::mat4 object_to_clip = world_to_clip * object_to_world;
-			glUniformMatrix4fv(simple_shading.object_to_clip_mat4, 1, GL_FALSE, glm::value_ptr(object_to_clip));
-		}
-		if (simple_shading.object_to_light_mat4x3 != -1U) {
-			glUniformMatrix4x3fv(simple_shading.object_to_light_mat4x3, 1, GL_FALSE, glm::value_ptr(object_to_world));
-		}
-		if (simple_shading.normal_to_light_mat3 != -1U) {
-			//NOTE: if there isn't any non-uniform scaling in the object_to_world matrix, then the inverse transpose is the matrix itself, and computing it wastes some CPU time:
-			glm::mat3 normal_to_world = glm::inverse(glm::transpose(glm::mat3(object_to_world)));
-			glUniformMatrix3fv(simple_shading.normal_to_light_mat3, 1, GL_FALSE, glm::value_ptr(normal_to_world));
+	//rather than issuing one draw call per object, build an object-to-world
+	// transform list per mesh bucket in the frame arena (plain cached memory,
+	// cheap to write and rewrite), then copy the compact lists into the
+	// streaming buffer at submit and draw each mesh exactly once:
+	for (uint32_t b = 0; b < 4; ++b) {
+		instance_data[b] = arena.alloc< glm::mat4 >(instance_capacity);
+		instance_counts[b] = 0;
+	}
+	//helper to queue a given mesh (by bucket index) with a given transformation:
+	auto add_instance = [&](uint32_t bucket, glm::mat4 const &object_to_world) {
+		if (uint32_t(instance_counts[bucket]) < instance_capacity) {
+			instance_data[bucket][instance_counts[bucket]++] = object_to_world;
 		}
-
-		//draw the mesh:
-		glDrawArrays(GL_TRIANGLES, mesh.first, mesh.count);
 	};
 
     //board background
-    draw_mesh(tile_mesh,
+    add_instance(3,
               glm::mat4(
                         4.5f, 0.0f, 0.0f, 0.0f,
                         0.0f, 4.6f, 0.0f, 0.0f,
@@ -437,69 +936,205 @@ void Game::draw(glm::uvec2 drawable_size) {
                         4.5f, 4.55f, -0.1f, 1.0f
                         )
               );
-    
+
     glm::quat dr = glm::angleAxis(12.0f, glm::vec3(3.0f, 0.0f, 0.0f)) * glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
-    
-    
-    //actually draw the mesh
-	for (uint32_t y = 0; y < board_size.y; ++y) {
-		for (uint32_t x = 0; x < board_size.x; ++x) {
+    //the rotation is the same for every object, so compute its matrix exactly once:
+    glm::mat4 rotation = glm::mat4_cast(glm::normalize(dr));
+
+    //fold each mesh's draw scale into the rotation columns, once per frame;
+    // the board loop then builds a cell's transform with store_cell_transform
+    // (column copies + a translation store) instead of a full matrix multiply:
+    auto scale_rotation = [&rotation](float s) -> glm::mat4 {
+        glm::mat4 out = rotation;
+        for (uint32_t col = 0; col < 3; ++col) {
+            //the scale is diag(s, s, 1), so it scales the x/y rows of every column:
+            out[col].x *= s;
+            out[col].y *= s;
+        }
+        return out;
+    };
+    glm::mat4 scaled_rotation[3];
+    for (uint32_t b = 0; b < 3; ++b) {
+        scaled_rotation[b] = scale_rotation(sizes[b]);
+    }
+
+    //actually queue the board meshes (cells of a row are contiguous bytes);
+    // only rows the camera fit can actually show are walked:
+	for (uint32_t y = visible_row_begin; y < visible_row_end; ++y) {
+		uint8_t const *row = snapshot.cells + y * GameBoard::Width;
+		for (uint32_t x = 0; x < GameBoard::Width; ++x) {
             //objects
-            if(board[x][y] != -1){
-                draw_mesh(mesh_array[board[x][y]],
-                    glm::mat4(
-                          sizes[board[x][y]], 0.0f, 0.0f, 0.0f,
-                          0.0f, sizes[board[x][y]], 0.0f, 0.0f,
-					      0.0f, 0.0f, 1.0f, 0.0f,
-					      x+0.5f, y+0.5f, 0.0f, 1.0f
-				     )
-                * glm::mat4_cast(glm::normalize(dr))
-                );
+            uint8_t cell = row[x];
+            if(cell != GameBoard::Empty){
+                //the ship slides smoothly between its last and current column:
+                float draw_x = float(x);
+                if(cell == 0 && int(x) == snapshot.ship_x && int(y) == snapshot.ship_y){
+                    draw_x = glm::mix(float(snapshot.prev_ship_x), float(snapshot.ship_x), alpha);
+                }
+                if (uint32_t(instance_counts[cell]) < instance_capacity) {
+                    store_cell_transform(
+                        instance_data[cell] + instance_counts[cell]++,
+                        scaled_rotation[cell], draw_x + 0.5f, float(y) + 0.5f);
+                }
             }
 		}
 	}
-    
-    //draw lives and scores
-    for (uint32_t i = 0; i < lives; i++) {
-        draw_mesh(mesh_array[0],
-                  glm::mat4(
-                            .8f, 0.0f, 0.0f, 0.0f,
-                            0.0f, 0.8f, 0.0f, 0.0f,
-                            0.0f, 0.0f, 1.0f, 0.0f,
-                            i-2.4f, 8.5f, 0.0f, 1.0f
-                            )
-                  * glm::mat4_cast(glm::normalize(dr))
-                  );
-    }
-    
-    int i = 0;
-    float j = 0;
-    for (uint32_t k = 0; k < score; k++) {
-        if(i % 3 == 0 && i != 0){
-            j += .5f;
-            i = 0;
+
+    //the HUD draws numbers as seven-segment digits built from thin slices of
+    // the tile mesh, so showing a score of N costs O(digits(N)) instances
+    // instead of one star mesh per point:
+    // segment bit order: 0=top, 1=top-right, 2=bottom-right, 3=bottom,
+    // 4=bottom-left, 5=top-left, 6=middle.
+    static uint8_t const DigitSegments[10] = {
+        0x3f, 0x06, 0x5b, 0x4f, 0x66, 0x6d, 0x7d, 0x07, 0x7f, 0x6f
+    };
+    //queue tile instances for the lit segments of one digit:
+    auto add_digit = [&](uint32_t value, glm::vec2 center, float size) {
+        float hw = 0.6f * size; //half-width of horizontal segments
+        float hh = 1.0f * size; //half-height of the digit
+        float t = 0.12f * size; //segment half-thickness
+        //segment centers and half-extents, in digit-local units:
+        static glm::vec4 const Segments[7] = {
+            glm::vec4( 0.0f, 1.0f, 1.0f, 0.0f), //top
+            glm::vec4( 1.0f, 0.5f, 0.0f, 0.5f), //top-right
+            glm::vec4( 1.0f,-0.5f, 0.0f, 0.5f), //bottom-right
+            glm::vec4( 0.0f,-1.0f, 1.0f, 0.0f), //bottom
+            glm::vec4(-1.0f,-0.5f, 0.0f, 0.5f), //bottom-left
+            glm::vec4(-1.0f, 0.5f, 0.0f, 0.5f), //top-left
+            glm::vec4( 0.0f, 0.0f, 1.0f, 0.0f), //middle
+        };
+        uint8_t segments = DigitSegments[value % 10];
+        for (uint32_t s = 0; s < 7; ++s) {
+            if (!(segments & (1 << s))) continue;
+            add_instance(3,
+                glm::mat4(
+                    Segments[s].z * hw + t, 0.0f, 0.0f, 0.0f,
+                    0.0f, Segments[s].w * hh + t, 0.0f, 0.0f,
+                    0.0f, 0.0f, 1.0f, 0.0f,
+                    center.x + Segments[s].x * hw, center.y + Segments[s].y * hh, 0.0f, 1.0f
+                    )
+                );
         }
-        draw_mesh(mesh_array[1],
-                  glm::mat4(
-                            0.2f, 0.0f, 0.0f, 0.0f,
-                            0.0f, 0.2f, 0.0f, 0.0f,
-                            0.0f, 0.0f, 1.0f, 0.0f,
-                            i-2.4f, 7.8f-j, 0.0f, 1.0f
-                            )
-                  * glm::mat4_cast(glm::normalize(dr))
-                  );
-        i++;
+    };
+
+    //lives: one ship glyph plus a count, instead of one ship per life:
+    if (uint32_t(instance_counts[0]) < instance_capacity) {
+        store_cell_transform(
+            instance_data[0] + instance_counts[0]++,
+            scale_rotation(0.8f), -2.4f, 8.5f);
+    }
+    add_digit(uint32_t(snapshot.lives), glm::vec2(-1.2f, 8.5f), 0.4f);
+
+    //score, right-aligned decimal digits:
+    {
+        uint32_t remaining = uint32_t(snapshot.score);
+        glm::vec2 at = glm::vec2(-1.2f, 7.2f);
+        do {
+            add_digit(remaining % 10, at, 0.4f);
+            remaining /= 10;
+            at.x -= 1.1f;
+        } while (remaining > 0);
     }
-    
-    
-    
+
+    { //copy the buckets' transforms into the streaming buffer back-to-back,
+      // then point the instance attribute at each bucket and draw all of its
+      // instances at once:
+		uint8_t *frame_data = reinterpret_cast< uint8_t * >(instance_stream.begin_frame());
+		size_t bucket_base[4];
+		size_t total = 0;
+		for (uint32_t b = 0; b < 4; ++b) {
+			bucket_base[b] = total;
+			memcpy(frame_data + total, instance_data[b], sizeof(glm::mat4) * instance_counts[b]);
+			total += sizeof(glm::mat4) * instance_counts[b];
+		}
+		instance_stream.flush(); //make this frame's writes visible before drawing
+
+		Mesh const *bucket_meshes[4] = {&mesh_array[0], &mesh_array[1], &mesh_array[2], &tile_mesh};
+		glBindBuffer(GL_ARRAY_BUFFER, instance_stream.buffer);
+		for (uint32_t b = 0; b < 4; ++b) {
+			if (instance_counts[b] == 0) continue;
+			if (simple_shading.Transform_mat4 != -1U) {
+				size_t base = instance_stream.offset() + bucket_base[b];
+				for (uint32_t col = 0; col < 4; ++col) {
+					glVertexAttribPointer(simple_shading.Transform_mat4 + col, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (GLbyte *)0 + base + col * sizeof(glm::vec4));
+				}
+			}
+			if (meshes_indexed) {
+				glDrawElementsInstanced(GL_TRIANGLES, bucket_meshes[b]->count, GL_UNSIGNED_INT, (GLbyte *)0 + sizeof(uint32_t) * bucket_meshes[b]->first, instance_counts[b]);
+			} else {
+				glDrawArraysInstanced(GL_TRIANGLES, bucket_meshes[b]->first, bucket_meshes[b]->count, instance_counts[b]);
+			}
+		}
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		instance_stream.end_frame(); //fence so the next write to this region waits for these draws
+	}
+
 	glUseProgram(0);
 
+	if (snapshot.game_over) {
+		//dim the board with a translucent world-space quad through the
+		// dynamic channel (drawn in front of the meshes; the scissor keeps it
+		// inside this board's viewport in split screen):
+		DynamicVertex quad[6];
+		glm::vec3 const normal = glm::vec3(0.0f, 0.0f, 1.0f);
+		glm::u8vec4 const dim = glm::u8vec4(0x00, 0x00, 0x00, 0x96);
+		float const x0 = -3.6f, x1 = 9.6f, y0 = -0.6f, y1 = 9.6f, z = 0.45f;
+		quad[0] = DynamicVertex{glm::vec3(x0, y0, z), normal, dim};
+		quad[1] = DynamicVertex{glm::vec3(x1, y0, z), normal, dim};
+		quad[2] = DynamicVertex{glm::vec3(x1, y1, z), normal, dim};
+		quad[3] = DynamicVertex{glm::vec3(x0, y0, z), normal, dim};
+		quad[4] = DynamicVertex{glm::vec3(x1, y1, z), normal, dim};
+		quad[5] = DynamicVertex{glm::vec3(x0, y1, z), normal, dim};
+		draw_dynamic(quad, 6);
+	}
+
+	glDisable(GL_SCISSOR_TEST); //so the next frame's clear covers the whole window
+
 	GL_ERRORS();
 }
 
 
 
+//Size the currently-bound buffer and fill it in fixed slices instead of one
+// giant glBufferData. The source chunks live in BlobFile's file mapping, so a
+// slice's pages are faulted in by the driver's copy as it reads them -- with
+// small slices, the kernel's read-ahead for the next slice overlaps the
+// driver's copy of this one, and for blobs bigger than memory the already-
+// uploaded pages can be evicted instead of accumulating:
+static void upload_in_slices(GLenum target, size_t size, void const *data, GLenum usage) {
+	constexpr size_t Slice = 8 << 20; //8 MB: big enough to amortize call overhead, small enough to pipeline
+	glBufferData(target, GLsizeiptr(size), nullptr, usage); //allocate without filling
+	uint8_t const *bytes = reinterpret_cast< uint8_t const * >(data);
+	for (size_t begin = 0; begin < size; begin += Slice) {
+		size_t length = std::min(Slice, size - begin);
+		glBufferSubData(target, GLintptr(begin), GLsizeiptr(length), bytes + begin);
+	}
+}
+
+//modification time of 'path' (seconds resolution), or 0 when unreadable:
+static int64_t file_mtime(std::string const &path) {
+	#ifdef _WIN32
+	struct _stat64 info;
+	if (_stat64(path.c_str(), &info) != 0) return 0;
+	#else
+	struct stat info;
+	if (stat(path.c_str(), &info) != 0) return 0;
+	#endif
+	return int64_t(info.st_mtime);
+}
+
+//FNV-1a over a byte range, for the hot-reload content diff:
+static uint64_t hash_bytes(void const *data, size_t size) {
+	uint8_t const *bytes = reinterpret_cast< uint8_t const * >(data);
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	for (size_t i = 0; i < size; ++i) {
+		hash ^= bytes[i];
+		hash *= 0x100000001b3ULL;
+	}
+	return hash;
+}
+
 //create and return an OpenGL vertex shader from source:
 static GLuint compile_shader(GLenum type, std::string const &source) {
 	GLuint shader = glCreateShader(type);
@@ -522,3 +1157,81 @@ static GLuint compile_shader(GLenum type, std::string const &source) {
 	}
 	return shader;
 }
+
+//true when the driver can save/restore linked program binaries:
+static bool program_binary_supported() {
+	#ifdef _WIN32
+	//these are post-3.2 entry points, bound optionally by the shims:
+	if (!glGetProgramBinary || !glProgramBinary || !glProgramParameteri) return false;
+	#endif
+	if (!have_gl_extension("GL_ARB_get_program_binary")) return false;
+	GLint formats = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+	return formats > 0;
+}
+
+//cache file location, keyed on driver identity so a stale binary from a
+// different GPU or driver version never gets loaded:
+static std::string program_binary_cache_path(std::string const &name) {
+	std::string key = name;
+	GLenum const props[3] = {GL_VENDOR, GL_RENDERER, GL_VERSION};
+	for (GLenum prop : props) {
+		char const *str = reinterpret_cast< char const * >(glGetString(prop));
+		key += "|";
+		key += (str ? str : "?");
+	}
+	//FNV-1a, folded into the file name:
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	for (char c : key) {
+		hash ^= uint8_t(c);
+		hash *= 0x100000001b3ULL;
+	}
+	char hex[17];
+	snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)hash);
+	return data_path("shader-cache-" + name + "-" + hex + ".bin");
+}
+
+//try to initialize 'program' from a cached binary; false on any miss/mismatch:
+static bool try_load_program_binary(GLuint program, std::string const &name) {
+	if (!program_binary_supported()) return false;
+
+	std::ifstream file(program_binary_cache_path(name), std::ios::binary | std::ios::ate);
+	if (!file) return false;
+	std::streamoff file_size = file.tellg();
+	if (file_size <= std::streamoff(sizeof(uint32_t))) return false;
+	file.seekg(0);
+
+	uint32_t format = 0;
+	std::vector< char > binary(size_t(file_size) - sizeof(uint32_t));
+	if (!file.read(reinterpret_cast< char * >(&format), sizeof(format))) return false;
+	if (!file.read(binary.data(), binary.size())) return false;
+
+	glProgramBinary(program, GLenum(format), binary.data(), GLsizei(binary.size()));
+
+	//the driver is free to reject the binary (e.g. after an update); treat
+	// that exactly like a cache miss:
+	GLint link_status = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &link_status);
+	return link_status == GL_TRUE;
+}
+
+//write the linked program's binary out for the next launch (best effort):
+static void store_program_binary(GLuint program, std::string const &name) {
+	if (!program_binary_supported()) return;
+
+	GLint length = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0) return;
+
+	std::vector< char > binary(size_t(length), 0);
+	GLenum format = 0;
+	GLsizei written = 0;
+	glGetProgramBinary(program, GLsizei(binary.size()), &written, &format, binary.data());
+	if (written <= 0) return;
+
+	std::ofstream file(program_binary_cache_path(name), std::ios::binary);
+	if (!file) return; //e.g. read-only install dir; not worth failing startup over
+	uint32_t format32 = uint32_t(format);
+	file.write(reinterpret_cast< char const * >(&format32), sizeof(format32));
+	file.write(binary.data(), written);
+}
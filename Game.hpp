@@ -1,58 +1,125 @@
 #pragma once
 
 #include "GL.hpp"
+#include "streaming_buffer.hpp"
+#include "game_state.hpp"
+#include "frame_arena.hpp"
 
 #include <SDL.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 
+#include <string>
 #include <vector>
 
-// The 'Game' struct holds all of the game-relevant state,
-// and is called by the main loop.
+// The 'Game' struct pairs one GameState (the plain-data simulation; see
+// game_state.hpp) with the GL resources to draw it, and is called by the
+// main loop. Simulation-only users (headless benchmarks, the batch
+// runner) work with GameState directly and never construct a Game.
 
 struct Game {
-	//Game creates OpenGL resources (i.e. vertex buffer objects) in its
-	//constructor and frees them in its destructor.
-	Game();
+	//aliases, so render-side code keeps reading naturally:
+	typedef GameState::GameBoard GameBoard;
+	typedef GameState::Snapshot DrawSnapshot;
+	static constexpr uint32_t DefaultSeed = GameState::DefaultSeed;
+	static constexpr float Tick = GameState::Tick;
+
+	//Game sets up simulation state always, and OpenGL resources (i.e. vertex
+	//buffer objects) only when 'headless' is false; resources are freed in
+	//the destructor. Headless games can update() but must not draw().
+	Game(bool headless = false, uint32_t seed = DefaultSeed);
 	~Game();
 
-	//handle_event is called when new mouse or keyboard events are received:
-	// (note that this might be many times per frame or never)
-	//The function should return 'true' if it handled the event.
-	bool handle_event(SDL_Event const &evt, glm::uvec2 window_size);
+	//update is called once per simulation tick with a snapshot of the
+	// frame's input (see input.hpp); raw SDL events never reach the game:
+	void update(float elapsed, InputSnapshot const &input);
+
+	//copy the current simulation state into 'snapshot'; called on whichever
+	// thread runs update() (never concurrently with it):
+	void make_snapshot(DrawSnapshot *snapshot) const;
+
+	//draw is called after update; 'alpha' in [0,1] is the fraction of a tick
+	// that has elapsed since the last update, for interpolated rendering.
+	//All transient draw data is allocated from 'arena', which the main loop
+	// resets once per frame. draw() reads only 'snapshot' plus GL state, so
+	// it is safe to call while another thread runs update():
+	void draw(glm::uvec2 drawable_size, float alpha, FrameArena &arena, DrawSnapshot const &snapshot);
+
+	//draw into a pixel rect of the drawable instead of all of it; calling
+	// this several times per frame with different rects and snapshots renders
+	// several boards in one process while sharing meshes_vbo, the shader
+	// program, and the streaming buffer (each call queues its instances into
+	// a fresh region of instance_stream, so the calls do not stomp each
+	// other). The full-drawable draw() above is this with the whole window.
+	void draw(glm::ivec2 viewport_min, glm::uvec2 viewport_size, float alpha, FrameArena &arena, DrawSnapshot const &snapshot);
 
-	//update is called at the start of a new frame, after events are handled:
-	void update(float elapsed);
+	//------- opengl resources -------
 
-	//draw is called after update:
-	void draw(glm::uvec2 drawable_size);
+	bool headless = false; //true when constructed without GL resources
 
-	//------- opengl resources -------
+	//compiles shaders, loads meshes.blob, and builds all GL objects; called
+	// from the constructor unless headless:
+	void init_graphics();
+
+	//uniform buffer binding points shared between the shaders and the C++ side:
+	enum : GLuint {
+		CameraBinding = 0,
+		LightingBinding = 1,
+	};
 
 	//shader program that draws lit objects with vertex colors:
 	struct {
 		GLuint program = -1U; //program object
 
-		//uniform locations:
-		GLuint object_to_clip_mat4 = -1U;
-		GLuint object_to_light_mat4x3 = -1U;
-		GLuint normal_to_light_mat3 = -1U;
-		GLuint sun_direction_vec3 = -1U;
-		GLuint sun_color_vec3 = -1U;
-		GLuint sky_direction_vec3 = -1U;
-		GLuint sky_color_vec3 = -1U;
+		//uniform block indices:
+		GLuint Camera_block = -1U; //per-frame world_to_clip matrix
+		GLuint Lighting_block = -1U; //constant sun/sky state
 
 		//attribute locations:
 		GLuint Position_vec4 = -1U;
 		GLuint Normal_vec3 = -1U;
 		GLuint Color_vec4 = -1U;
+		GLuint Transform_mat4 = -1U; //per-instance; occupies four consecutive locations
+
+		//uniform locations (position dequantization, for 'dat1' blobs):
+		GLint position_scale_vec3 = -1;
+		GLint position_bias_vec3 = -1;
 	} simple_shading;
 
+	//dequantization constants currently applied by the vertex shader
+	// (identity for float blobs); draw_dynamic() bypasses and restores them:
+	glm::vec3 position_scale_value = glm::vec3(1.0f, 1.0f, 1.0f);
+	glm::vec3 position_bias_value = glm::vec3(0.0f, 0.0f, 0.0f);
+
 	//mesh data, stored in a vertex buffer:
 	GLuint meshes_vbo = -1U; //vertex buffer holding mesh data
+	GLuint meshes_ebo = -1U; //element buffer (only for blobs with an 'eidx' chunk)
+	bool meshes_indexed = false; //true when meshes draw through the element buffer
+
+	//uniform buffers backing the Camera and Lighting blocks:
+	GLuint camera_ubo = -1U; //world_to_clip; refreshed by draw() on resize
+	GLuint lighting_ubo = -1U; //sun/sky constants; uploaded once at init
+
+	//world_to_clip depends only on the viewport size, so draw() remembers the
+	// size the camera UBO was last filled for and skips the no-op re-upload
+	// (and the matrix rebuild) on every other frame; split-screen boards with
+	// equal-sized viewports share one upload the same way:
+	glm::uvec2 camera_uploaded_size = glm::uvec2(0, 0);
+
+	//rows of the board that land inside the viewport, derived from the camera
+	// fit whenever the matrix is rebuilt; the board loop in draw() touches
+	// only this span, so draw cost is O(visible cells) even when the board
+	// type is made much taller than the screen:
+	uint32_t visible_row_begin = 0;
+	uint32_t visible_row_end = GameBoard::Height;
+
+	//per-instance transforms, streamed to the graphics card every frame
+	// through a persistently-mapped (where supported) triple-buffered ring:
+	StreamingBuffer instance_stream;
 
 	//The location of each mesh in the meshes vertex buffer:
+	// ('first' and 'count' are in vertices for plain blobs, and in element
+	//  buffer entries for blobs carrying an 'eidx' chunk)
 	struct Mesh {
 		GLint first = 0;
 		GLsizei count = 0;
@@ -64,27 +131,65 @@ struct Game {
 	Mesh brick_mesh;
     Mesh mesh_array[3];
     float sizes[3];
-    
-    int ship_x;
-    int ship_y;
-    
-    int score = 0;
-    int lives = 3;
-    int game_over = 0;
-    
-    int board[9][9];
+
+	//instance transforms for each drawable mesh, built by draw() in the frame
+	// arena and then copied compactly into the streaming buffer, so each mesh
+	// is drawn with a single glDrawArraysInstanced call:
+	// buckets [0..2] follow mesh_array (ship, star, brick); bucket [3] is tile_mesh.
+	uint32_t instance_capacity = 0; //max transforms per bucket (sized from the board)
+	glm::mat4 *instance_data[4] = {nullptr, nullptr, nullptr, nullptr}; //arena-allocated lists; only valid inside draw()
+	GLsizei instance_counts[4] = {0, 0, 0, 0};
 
 	GLuint meshes_for_simple_shading_vao = -1U; //vertex array object that describes how to connect the meshes_vbo to the simple_shading_program
 
+	//------- dynamic geometry channel -------
+
+	//world-space vertex for overlay/debug geometry; same attribute layout the
+	// simple_shading program reads from float blobs:
+	struct DynamicVertex {
+		glm::vec3 Position;
+		glm::vec3 Normal;
+		glm::u8vec4 Color;
+	};
+
+	//draw a triangle list of up to dynamic_capacity vertices this frame. The
+	// data streams through a triple-buffered buffer of its own (never the
+	// static meshes_vbo, so overlays never stall against it) and draws with
+	// an identity object-to-world transform. GL thread only; any number of
+	// calls per frame:
+	void draw_dynamic(DynamicVertex const *vertices, uint32_t count);
+
+	uint32_t dynamic_capacity = 0; //max vertices per draw_dynamic call
+	StreamingBuffer dynamic_stream; //triple-buffered storage for the channel
+	GLuint dynamic_vao = -1U; //simple_shading-compatible VAO over dynamic_stream
+
+	//------- hot reload -------
+
+	//cheap mtime poll (throttled internally); when meshes.blob changed on
+	// disk, re-reads it and patches only the changed ranges of the live
+	// buffers with glBufferSubData -- no VAO or program recreation -- so
+	// artists see re-exports without restarting. Call from the GL thread:
+	void poll_reload();
+
+	int64_t meshes_blob_mtime = 0; //mtime the live buffers were loaded from
+	std::chrono::steady_clock::time_point next_reload_check; //poll throttle
+	bool meshes_quantized = false; //chunk version of the live vertex buffer
+	size_t meshes_vbo_bytes = 0; //size of the live vertex data
+	size_t meshes_ebo_bytes = 0; //size of the live element data (indexed blobs)
+	uint64_t vertex_data_hash = 0; //hash of all live vertex bytes
+	//per-mesh ranges + content hashes from the last upload, for the diff:
+	struct ReloadEntry {
+		std::string name;
+		uint32_t first = 0, count = 0; //vertices (elements, for indexed blobs)
+		uint64_t hash = 0; //content hash of the range
+	};
+	std::vector< ReloadEntry > reload_entries;
+
 	//------- game state -------
 
-	glm::uvec2 board_size = glm::uvec2(9,9);
+	//the one simulation instance this Game renders:
+	GameState state;
 
 	glm::uvec2 cursor = glm::vec2(0,0);
 
-	struct {
-		bool left = false;
-		bool right = false;
-	} controls;
-
 };
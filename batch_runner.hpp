@@ -0,0 +1,56 @@
+#pragma once
+
+#include "game_state.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+// run_batch steps many independent GameState instances across all cores,
+// for bot training and soak testing. Instances are handed out in small
+// chunks through a shared atomic cursor, so a thread that finishes its
+// chunk early immediately claims the next one instead of idling behind a
+// static partition (the cursor plays the role of a work-stealing deque;
+// with identical-cost items, chunk claiming balances just as well and is
+// a single fetch_add).
+//
+// 'input_for' is called as input_for(state, instance, tick) before every
+// step and returns the InputSnapshot to feed it; it runs concurrently
+// across instances, so it must only touch the state it is handed.
+
+template< typename InputPolicy >
+void run_batch(GameState *states, uint32_t count, uint64_t ticks, InputPolicy &&input_for, uint32_t thread_count = 0) {
+	if (thread_count == 0) {
+		thread_count = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	//each claim is a few instances, so claim overhead stays negligible while
+	// load still balances when some instances run slower than others:
+	constexpr uint32_t Chunk = 16;
+
+	std::atomic< uint32_t > cursor{0};
+	auto worker = [&](){
+		for (;;) {
+			uint32_t begin = cursor.fetch_add(Chunk, std::memory_order_relaxed);
+			if (begin >= count) return;
+			uint32_t end = std::min(begin + Chunk, count);
+			for (uint32_t i = begin; i < end; ++i) {
+				GameState &state = states[i];
+				for (uint64_t t = 0; t < ticks; ++t) {
+					state.step(input_for(state, i, t));
+				}
+			}
+		}
+	};
+
+	std::vector< std::thread > threads;
+	threads.reserve(thread_count - 1);
+	for (uint32_t i = 1; i < thread_count; ++i) {
+		threads.emplace_back(worker);
+	}
+	worker(); //the calling thread works too
+	for (auto &thread : threads) {
+		thread.join();
+	}
+}
@@ -0,0 +1,89 @@
+#include "blob_file.hpp"
+
+#include <fstream>
+#include <iostream>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+BlobFile::BlobFile(std::string const &path) {
+	#if defined(_WIN32)
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file != INVALID_HANDLE_VALUE) {
+		LARGE_INTEGER file_size;
+		if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0) {
+			HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+			if (mapping) {
+				void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+				if (view) {
+					data = reinterpret_cast< uint8_t const * >(view);
+					size = size_t(file_size.QuadPart);
+					mapped = true;
+					file_handle = file;
+					mapping_handle = mapping;
+					return;
+				}
+				CloseHandle(mapping);
+			}
+		}
+		CloseHandle(file);
+	}
+	#else
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd != -1) {
+		struct stat st;
+		if (fstat(fd, &st) == 0 && st.st_size > 0) {
+			void *view = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+			if (view != MAP_FAILED) {
+				//the mapping keeps the file alive, so the descriptor can go:
+				close(fd);
+				data = reinterpret_cast< uint8_t const * >(view);
+				size = size_t(st.st_size);
+				mapped = true;
+				return;
+			}
+		}
+		close(fd);
+	}
+	#endif
+
+	//mapping failed (odd filesystem? zero-length file?); fall back to a plain read:
+	std::ifstream file_stream(path, std::ios::binary | std::ios::ate);
+	if (!file_stream) {
+		throw std::runtime_error("Failed to open '" + path + "'");
+	}
+	std::streamoff file_size = file_stream.tellg();
+	file_stream.seekg(0);
+	uint8_t *heap = new uint8_t[size_t(file_size)];
+	if (!file_stream.read(reinterpret_cast< char * >(heap), file_size)) {
+		delete[] heap;
+		throw std::runtime_error("Failed to read '" + path + "'");
+	}
+	std::cerr << "NOTE: couldn't map '" << path << "'; read it into memory instead." << std::endl;
+	data = heap;
+	size = size_t(file_size);
+	mapped = false;
+}
+
+BlobFile::~BlobFile() {
+	if (!data) return;
+	if (mapped) {
+		#if defined(_WIN32)
+		UnmapViewOfFile(const_cast< uint8_t * >(data));
+		CloseHandle(mapping_handle);
+		CloseHandle(file_handle);
+		#else
+		munmap(const_cast< uint8_t * >(data), size);
+		#endif
+	} else {
+		delete[] data;
+	}
+	data = nullptr;
+	size = 0;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+//BlobFile maps an asset blob (e.g. dist/meshes.blob) into memory — mmap on
+// Linux/macOS, MapViewOfFile on Windows — so chunks can be validated and
+// consumed in place: large payloads go straight from the mapping into GL
+// buffers with no intermediate std::vector and no second copy in RSS.
+//If mapping fails for some reason, the file is read into heap memory instead
+// and everything else behaves the same.
+//
+//Chunks follow the read_chunk.hpp convention: an 8-byte header (4-character
+// magic + uint32_t payload byte count) followed by the payload.
+//NOTE: payload pointers are only as aligned as the preceding chunks make
+// them; copy out (memcpy) any multi-byte structures read from chunks that
+// follow a variable-length chunk.
+
+struct BlobFile {
+	explicit BlobFile(std::string const &path); //throws std::runtime_error on failure
+	~BlobFile();
+
+	BlobFile(BlobFile const &) = delete;
+	BlobFile &operator=(BlobFile const &) = delete;
+
+	uint8_t const *data = nullptr;
+	size_t size = 0;
+
+	//check the next chunk's header against 'magic' and that its payload is a
+	// whole number of T's; returns the payload (in place) and stores the
+	// element count, advancing the read cursor past the chunk:
+	template< typename T >
+	T const *read_chunk(char const *magic, uint32_t *count_) {
+		assert(count_);
+		assert(magic && strlen(magic) == 4);
+		if (cursor + 8 > size) {
+			throw std::runtime_error("Failed to read chunk header");
+		}
+		if (0 != memcmp(data + cursor, magic, 4)) {
+			throw std::runtime_error("Unexpected magic number in chunk");
+		}
+		uint32_t bytes;
+		memcpy(&bytes, data + cursor + 4, 4);
+		if (bytes % sizeof(T) != 0) {
+			throw std::runtime_error("Size of chunk not divisible by element size");
+		}
+		if (cursor + 8 + bytes > size) {
+			throw std::runtime_error("Chunk data extends past end of file");
+		}
+		T const *ret = reinterpret_cast< T const * >(data + cursor + 8);
+		*count_ = bytes / uint32_t(sizeof(T));
+		cursor += 8 + bytes;
+		return ret;
+	}
+
+	//true if the next chunk exists and has the given magic (for optional chunks):
+	bool peek_chunk(char const *magic) const {
+		assert(magic && strlen(magic) == 4);
+		return cursor + 8 <= size && 0 == memcmp(data + cursor, magic, 4);
+	}
+
+	//true once every chunk has been consumed:
+	bool at_end() const { return cursor == size; }
+
+	//------ internals ------
+	size_t cursor = 0; //read position for the chunk helpers
+	bool mapped = false; //true when 'data' is a file mapping, false when heap fallback
+	#ifdef _WIN32
+	void *file_handle = nullptr;
+	void *mapping_handle = nullptr;
+	#endif
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+// Board< W, H > stores a fixed-size game board as a flat, row-major array of
+// byte-sized cells, so the row-at-a-time scans in Game::update and
+// Game::draw walk contiguous memory instead of striding across an
+// int[col][row] array. The dimensions are compile-time constants; code that
+// needs them should read Width/Height rather than keeping a separate
+// runtime size that has to agree with the array bounds.
+//
+// Row 0 holds the ship and never moves; rows 1..H-1 are a ring, so
+// scrolling the board is an O(1) head bump (advance()) plus a refill of
+// the top row instead of an O(W*H) copy of every cell. Callers index
+// *logical* rows -- at()/row() fold in the ring offset.
+
+template< uint32_t W, uint32_t H >
+struct Board {
+	static constexpr uint32_t Width = W;
+	static constexpr uint32_t Height = H;
+
+	//cell values 0,1,2,... index Game::mesh_array; Empty marks a vacant cell
+	// (takes the place of the old 'int' board's -1 sentinel):
+	static constexpr uint8_t Empty = 0xff;
+
+	uint8_t cells[W * H];
+
+	//ring head: logical row 1 currently lives in physical row 1 + scroll:
+	uint32_t scroll = 0;
+
+	//map a logical row to where it is stored (row 0 is outside the ring):
+	uint32_t physical_row(uint32_t y) const {
+		return (y == 0 ? 0 : 1 + (y - 1 + scroll) % (H - 1));
+	}
+
+	//cells are stored row-major, so at(x,y) and at(x+1,y) are adjacent:
+	uint8_t &at(uint32_t x, uint32_t y) { return cells[physical_row(y) * W + x]; }
+	uint8_t const &at(uint32_t x, uint32_t y) const { return cells[physical_row(y) * W + x]; }
+
+	//first cell of logical row y (rows are contiguous spans of Width cells):
+	uint8_t *row(uint32_t y) { return cells + physical_row(y) * W; }
+	uint8_t const *row(uint32_t y) const { return cells + physical_row(y) * W; }
+
+	void fill(uint8_t value) { memset(cells, value, sizeof(cells)); }
+
+	//scroll rows 1..H-1 down one step: old row 2 becomes row 1, and so on.
+	//The storage behind old row 1 becomes the new top row (H-1); the caller
+	//is expected to refill it (it still holds the discarded row's cells).
+	void advance() { scroll = (scroll + 1) % (H - 1); }
+};
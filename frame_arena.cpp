@@ -0,0 +1,50 @@
+#include "frame_arena.hpp"
+
+FrameArena::FrameArena(size_t initial_size) {
+	Block block;
+	block.storage.reset(new uint8_t[initial_size]);
+	block.size = initial_size;
+	blocks.emplace_back(std::move(block));
+}
+
+void *FrameArena::alloc_bytes(size_t size, size_t align) {
+	Block &block = blocks.back();
+	size_t offset = (block.offset + align - 1) / align * align;
+	if (offset + size <= block.size) {
+		block.offset = offset + size;
+		return block.storage.get() + offset;
+	}
+
+	//the frame overflowed the block; spill into a fresh one at least twice
+	// the size (reset() merges the spills so this stays rare):
+	Block spill;
+	spill.size = blocks.front().size;
+	while (spill.size < size) spill.size *= 2;
+	spill.size *= 2;
+	spill.storage.reset(new uint8_t[spill.size]);
+	spill.offset = size;
+	blocks.emplace_back(std::move(spill));
+	return blocks.back().storage.get();
+}
+
+void FrameArena::reset() {
+	if (blocks.size() > 1) {
+		//replace the block list with one block big enough for the whole of
+		// the frame that just ended:
+		size_t total = 0;
+		for (Block const &block : blocks) total += block.size;
+		blocks.clear();
+		Block block;
+		block.storage.reset(new uint8_t[total]);
+		block.size = total;
+		blocks.emplace_back(std::move(block));
+	} else {
+		blocks.back().offset = 0;
+	}
+}
+
+size_t FrameArena::used() const {
+	size_t total = 0;
+	for (Block const &block : blocks) total += block.offset;
+	return total;
+}
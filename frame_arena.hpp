@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// FrameArena is a bump-pointer allocator for data that lives exactly one
+// frame (instance transform lists, HUD scratch, and so on). The main loop
+// reset()s it once per frame; allocation is then a pointer bump, so
+// transient draw data never touches malloc in the steady state and stays
+// hot in cache across the build-then-submit phases of a frame.
+//
+// Allocations are never individually freed and destructors never run, so
+// only trivially-destructible types belong here.
+
+struct FrameArena {
+	//construct with a starting capacity (the arena grows if a frame
+	// overflows it, and keeps the larger size from then on):
+	FrameArena(size_t initial_size = 256 * 1024);
+
+	//uninitialized storage for 'count' objects of T, aligned for T:
+	template< typename T >
+	T *alloc(uint32_t count) {
+		return reinterpret_cast< T * >(alloc_bytes(sizeof(T) * count, alignof(T)));
+	}
+
+	void *alloc_bytes(size_t size, size_t align);
+
+	//start a new frame: all outstanding allocations become invalid. If the
+	// last frame spilled into extra blocks, they are merged into one block
+	// so future frames bump through contiguous storage again:
+	void reset();
+
+	//bytes handed out since the last reset (high-water mark for sizing):
+	size_t used() const;
+
+	struct Block {
+		std::unique_ptr< uint8_t[] > storage;
+		size_t size = 0;
+		size_t offset = 0;
+	};
+	std::vector< Block > blocks; //blocks[0] is the main block; spills append
+};
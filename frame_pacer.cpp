@@ -0,0 +1,40 @@
+#include "frame_pacer.hpp"
+
+#include <thread>
+
+void FramePacer::set_mode(Mode mode_, float target_fps) {
+	mode = mode_;
+	if (mode == Capped) {
+		period = std::chrono::duration_cast< std::chrono::steady_clock::duration >(
+			std::chrono::duration< double >(1.0 / double(target_fps)));
+		deadline = std::chrono::steady_clock::now() + period;
+	} else {
+		period = std::chrono::steady_clock::duration(0);
+	}
+}
+
+void FramePacer::pace() {
+	if (mode != Capped) return;
+
+	//sleep_until typically overshoots by a scheduler quantum, so stop the
+	// sleep a little early and spin out the remainder; the spin window is a
+	// fraction of a millisecond, so it costs power only when the frame was
+	// nearly on time anyway:
+	constexpr std::chrono::microseconds SpinWindow(300);
+
+	auto now = std::chrono::steady_clock::now();
+	if (deadline - now > SpinWindow) {
+		std::this_thread::sleep_until(deadline - SpinWindow);
+	}
+	while (std::chrono::steady_clock::now() < deadline) {
+		//spin; the loop body is just the clock read
+	}
+
+	//hold the cadence frame-to-frame (resync rather than spiral when a frame
+	// ran long past its deadline):
+	deadline += period;
+	now = std::chrono::steady_clock::now();
+	if (now > deadline) {
+		deadline = now + period;
+	}
+}
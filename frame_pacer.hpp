@@ -0,0 +1,36 @@
+#pragma once
+
+#include <chrono>
+
+// FramePacer owns the decision of when the next frame is allowed to present.
+// Three modes:
+//  - Vsync: the display paces us; pace() is a no-op (SwapWindow blocks).
+//  - Uncapped: no pacing at all (replays/benchmarks); pace() is a no-op.
+//  - Capped: a target-FPS limiter for builds where vsync is the wrong tool
+//    (battery-powered handhelds cap below refresh; uncapped burns a core).
+//    pace() sleeps until just short of the frame deadline, then spins the
+//    last stretch -- sleep_until alone wakes late by a scheduler quantum,
+//    while sleeping most of the wait and spinning ~the last 300 us lands
+//    within ~100 us of the deadline without measurable power cost.
+//
+// The caller still sets SDL_GL_SetSwapInterval to match (interval 0 for
+// Uncapped/Capped); this module is SDL-free on purpose so the headless and
+// batch paths could reuse it.
+
+struct FramePacer {
+	enum Mode {
+		Vsync,
+		Uncapped,
+		Capped,
+	};
+
+	//select the mode; 'target_fps' only matters for Capped:
+	void set_mode(Mode mode, float target_fps = 0.0f);
+
+	//block until this frame may present; call once per frame, after the swap:
+	void pace();
+
+	Mode mode = Vsync;
+	std::chrono::steady_clock::duration period = std::chrono::steady_clock::duration(0);
+	std::chrono::steady_clock::time_point deadline; //when the next frame may present
+};
@@ -0,0 +1,104 @@
+#include "frame_profiler.hpp"
+
+#include <fstream>
+#include <iostream>
+
+FrameProfiler::FrameProfiler() {
+	gpu_supported = true;
+	#ifdef _WIN32
+	//glGetQueryObjectui64v is a post-3.2 entry point, bound optionally by the shims:
+	gpu_supported = (glGetQueryObjectui64v != nullptr);
+	#endif
+	if (gpu_supported) {
+		glGenQueries(QueryCount, queries);
+	}
+}
+
+FrameProfiler::~FrameProfiler() {
+	destroy();
+
+	//print the frame-time histogram for a quick look without opening the csv:
+	uint32_t total = 0;
+	for (uint32_t b = 0; b < HistogramBuckets; ++b) total += histogram[b];
+	if (total == 0) return;
+	std::cerr << "Frame time histogram (" << total << " frames):" << std::endl;
+	for (uint32_t b = 0; b < HistogramBuckets; ++b) {
+		if (histogram[b] == 0) continue;
+		std::cerr << "  [" << 0.5f * b << ", " << 0.5f * (b + 1) << ") ms: " << histogram[b] << std::endl;
+	}
+}
+
+void FrameProfiler::destroy() {
+	if (gpu_supported && queries[0] != 0) {
+		glDeleteQueries(QueryCount, queries);
+		for (uint32_t q = 0; q < QueryCount; ++q) queries[q] = 0;
+	}
+}
+
+void FrameProfiler::begin(Stage stage) {
+	stage_begin[stage] = Clock::now();
+}
+
+void FrameProfiler::end(Stage stage) {
+	current.stage_ms[stage] = std::chrono::duration< float, std::milli >(Clock::now() - stage_begin[stage]).count();
+}
+
+void FrameProfiler::begin_gpu() {
+	if (!gpu_supported) return;
+	//the query being reused was issued QueryCount frames ago, so its result
+	// is (essentially) always already available and this read doesn't stall:
+	if (query_issued[query_write]) {
+		GLuint64 nanoseconds = 0;
+		glGetQueryObjectui64v(queries[query_write], GL_QUERY_RESULT, &nanoseconds);
+		gpu_ms = float(nanoseconds) * 1e-6f;
+		query_issued[query_write] = false;
+	}
+	glBeginQuery(GL_TIME_ELAPSED, queries[query_write]);
+}
+
+void FrameProfiler::end_gpu() {
+	if (!gpu_supported) return;
+	glEndQuery(GL_TIME_ELAPSED);
+	query_issued[query_write] = true;
+	query_write = (query_write + 1) % QueryCount;
+}
+
+void FrameProfiler::end_frame() {
+	Clock::time_point now = Clock::now();
+	if (have_previous_frame) {
+		current.frame_ms = std::chrono::duration< float, std::milli >(now - previous_frame).count();
+		uint32_t bucket = uint32_t(current.frame_ms / 0.5f);
+		if (bucket >= HistogramBuckets) bucket = HistogramBuckets - 1;
+		histogram[bucket] += 1;
+	}
+	previous_frame = now;
+	have_previous_frame = true;
+
+	current.gpu_ms = gpu_ms;
+	history.push_back(current);
+	current = FrameRecord();
+}
+
+void FrameProfiler::dump_csv(std::string const &path) const {
+	std::ofstream out(path);
+	if (!out) {
+		std::cerr << "WARNING: failed to open '" << path << "' for profile dump." << std::endl;
+		return;
+	}
+	out << "frame,frame_ms,events_ms,update_ms,draw_ms,swap_ms,gpu_draw_ms\n";
+	for (size_t f = 0; f < history.size(); ++f) {
+		FrameRecord const &r = history[f];
+		out << f << ',' << r.frame_ms
+			<< ',' << r.stage_ms[Events]
+			<< ',' << r.stage_ms[Update]
+			<< ',' << r.stage_ms[Draw]
+			<< ',' << r.stage_ms[Swap]
+			<< ',' << r.gpu_ms << '\n';
+	}
+	//histogram footer (rows marked so they're easy to filter out):
+	for (uint32_t b = 0; b < HistogramBuckets; ++b) {
+		if (histogram[b] == 0) continue;
+		out << "#histogram," << 0.5f * b << ',' << histogram[b] << '\n';
+	}
+	std::cerr << "Wrote " << history.size() << " frame timings to '" << path << "'." << std::endl;
+}
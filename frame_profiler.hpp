@@ -0,0 +1,77 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//FrameProfiler records where each frame's time goes:
+// - CPU time per stage (event handling / update / draw / swap), via std::chrono;
+// - GPU time for the draw stage, via a small ring of GL_TIME_ELAPSED queries
+//   (so reading results never stalls the pipeline);
+// - a rolling histogram of whole-frame times.
+//dump_csv() writes every recorded frame out for offline triage, and the
+// histogram is printed when the profiler is destroyed.
+
+struct FrameProfiler {
+	enum Stage : uint32_t {
+		Events = 0,
+		Update,
+		Draw,
+		Swap,
+		StageCount
+	};
+
+	FrameProfiler(); //note: creates GL query objects, so needs a current context
+	~FrameProfiler();
+
+	//free GL resources; call before tearing down the GL context:
+	void destroy();
+
+	//CPU scopes (begin/end must nest per stage, once per frame):
+	void begin(Stage stage);
+	void end(Stage stage);
+
+	//GPU scope; bracket the GL calls of the draw stage:
+	void begin_gpu();
+	void end_gpu();
+
+	//fold the current frame's timings into the history; call once per frame,
+	// after the swap:
+	void end_frame();
+
+	//write one CSV row per recorded frame (plus a histogram footer) to 'path':
+	void dump_csv(std::string const &path) const;
+
+	//------ internals ------
+
+	typedef std::chrono::high_resolution_clock Clock;
+
+	Clock::time_point stage_begin[StageCount];
+	Clock::time_point previous_frame; //for whole-frame (frame-to-frame) time
+	bool have_previous_frame = false;
+
+	struct FrameRecord {
+		float stage_ms[StageCount] = {0.0f, 0.0f, 0.0f, 0.0f};
+		float frame_ms = 0.0f; //frame-to-frame wall time
+		float gpu_ms = -1.0f; //most recently retired GPU timing (lags a few frames); -1 if unknown
+	};
+	FrameRecord current;
+	std::vector< FrameRecord > history;
+
+	//rolling histogram of frame-to-frame times, in half-millisecond buckets
+	// (the last bucket collects everything at or past 50ms):
+	enum : uint32_t { HistogramBuckets = 100 };
+	uint32_t histogram[HistogramBuckets] = {};
+
+	//GL_TIME_ELAPSED query ring; deep enough that the query being reused is
+	// always long since retired:
+	enum : uint32_t { QueryCount = 4 };
+	GLuint queries[QueryCount] = {0, 0, 0, 0};
+	bool query_issued[QueryCount] = {false, false, false, false};
+	uint32_t query_write = 0;
+	float gpu_ms = -1.0f; //latest retired result
+	bool gpu_supported = false;
+};
@@ -0,0 +1,113 @@
+#include "game_state.hpp"
+
+#include <cstring>
+#include <utility>
+
+void GameState::reset(uint32_t seed) {
+	mt.seed(seed);
+
+	board.fill(GameBoard::Empty);
+	board.scroll = 0;
+
+	ship_x = 4;
+	ship_y = 0;
+	prev_ship_x = ship_x;
+
+	score = 0;
+	lives = 3;
+	game_over = 0;
+
+	board.at(4, 0) = 0;
+
+	//fill in board
+	for (uint32_t i = 2; i < GameBoard::Height; i++) {
+		spawn_row(board.row(i));
+	}
+}
+
+void GameState::spawn_row(uint8_t *row) {
+	uint32_t blocks = mt() % 3 + 1;
+	uint32_t stars = mt() % 2;
+
+	memset(row, GameBoard::Empty, GameBoard::Width);
+
+	//partial Fisher-Yates over the column list: the first (blocks + stars)
+	// entries end up as a uniform pick of distinct columns, with no rejection
+	// loop whose cost grows as the row fills up:
+	uint8_t cols[GameBoard::Width];
+	for (uint32_t i = 0; i < GameBoard::Width; ++i) cols[i] = uint8_t(i);
+	for (uint32_t i = 0; i < blocks + stars; ++i) {
+		uint32_t pick = i + mt() % (GameBoard::Width - i);
+		std::swap(cols[i], cols[pick]);
+		row[cols[i]] = (i < blocks ? 2 : 1);
+	}
+}
+
+void GameState::step(InputSnapshot const &input) {
+	//if the arrow keys are pressed, move ship and update board
+
+    if(game_over == 1){
+        return;
+    }
+
+    //remember where the ship was, so draw() can interpolate toward the new column:
+    prev_ship_x = ship_x;
+
+    if(input.was_pressed(InputSnapshot::Left) && ship_x != 0){
+        board.at(ship_x, ship_y) = GameBoard::Empty;
+        ship_x--;
+        board.at(ship_x, ship_y) = 0;
+
+        if(board.at(ship_x, ship_y + 1) == 1){
+            score++;
+        }
+        if(board.at(ship_x, ship_y + 1) == 2){
+            lives--;
+            if(lives == 0){
+                game_over = 1;
+            }
+        }
+        //move blocks down: O(1) ring-head bump instead of copying every row:
+        board.advance();
+        //refill the (now stale) top row:
+        spawn_row(board.row(GameBoard::Height - 1));
+    }else if(input.was_pressed(InputSnapshot::Right) && ship_x != int(GameBoard::Width) - 1){
+        board.at(ship_x, ship_y) = GameBoard::Empty;
+        ship_x++;
+        board.at(ship_x, ship_y) = 0;
+
+        if(board.at(ship_x, ship_y + 1) == 1){
+            score++;
+        }
+        if(board.at(ship_x, ship_y + 1) == 2){
+            lives--;
+            if(lives == 0){
+                game_over = 1;
+            }
+        }
+
+        //move blocks down: O(1) ring-head bump instead of copying every row:
+        board.advance();
+        //refill the (now stale) top row:
+        spawn_row(board.row(GameBoard::Height - 1));
+    }
+
+    if(score == 49){
+        game_over = 1;
+    }
+}
+
+void GameState::snapshot(Snapshot *snapshot_) const {
+	Snapshot &snapshot = *snapshot_;
+	//rows are contiguous; copying row-by-row resolves the ring offset:
+	for (uint32_t y = 0; y < GameBoard::Height; ++y) {
+		memcpy(snapshot.cells + y * GameBoard::Width, board.row(y), GameBoard::Width);
+	}
+	snapshot.ship_x = ship_x;
+	snapshot.prev_ship_x = prev_ship_x;
+	snapshot.ship_y = ship_y;
+	snapshot.score = score;
+	snapshot.lives = lives;
+	snapshot.game_over = game_over;
+	snapshot.tick_time = std::chrono::high_resolution_clock::now();
+}
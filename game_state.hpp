@@ -0,0 +1,68 @@
+#pragma once
+
+#include "board.hpp"
+#include "input.hpp"
+
+#include <random>
+#include <chrono>
+#include <cstdint>
+
+// GameState is the plain-data simulation half of the game: board, ship,
+// score, and the RNG -- no GL, no window, nothing that ties an instance to
+// a context. Thousands of instances can be stepped independently (see
+// batch_runner.hpp); the Game struct owns one instance plus the GL
+// resources to draw it, and a renderer can visualize any instance by
+// taking its Snapshot and handing it to Game::draw.
+
+struct GameState {
+	//the board's dimensions are baked into the type, so loops over it can be
+	// fully unrolled/vectorized and nothing needs a runtime size check:
+	typedef Board< 9, 9 > GameBoard;
+
+	//simulation runs at a fixed rate, decoupled from display refresh:
+	static constexpr float Tick = 1.0f / 120.0f;
+
+	//all board randomness flows from the seed, so two states constructed
+	// with the same seed and fed the same controls play out identically
+	// (the basis of the replay system; see replay.hpp):
+	static constexpr uint32_t DefaultSeed = 0xbead1234;
+
+	GameState(uint32_t seed = DefaultSeed) { reset(seed); }
+
+	//re-seed and restore the starting board/ship/score:
+	void reset(uint32_t seed);
+
+	//advance the simulation one fixed tick (see input.hpp for the snapshot):
+	void step(InputSnapshot const &input);
+
+	//clear 'row' (a span of GameBoard::Width cells) and spawn a fresh set of
+	// bricks and stars into distinct cells, in O(Width) worst case:
+	void spawn_row(uint8_t *row);
+
+	//Snapshot is an immutable copy of everything a renderer reads, so a
+	// render thread can draw frame N while this state already simulates
+	// frame N+1 (see the pipelined main loop):
+	struct Snapshot {
+		uint8_t cells[GameBoard::Width * GameBoard::Height]; //row-major, ring offset already resolved
+		int ship_x = 4, prev_ship_x = 4, ship_y = 0;
+		int score = 0, lives = 3, game_over = 0;
+		//when the tick that produced this state ran; the renderer derives
+		// its interpolation alpha from this:
+		std::chrono::high_resolution_clock::time_point tick_time;
+	};
+
+	//copy the current state into 'snapshot'; called on whichever thread
+	// runs step() (never concurrently with it):
+	void snapshot(Snapshot *snapshot) const;
+
+	GameBoard board;
+	std::mt19937 mt;
+
+	int ship_x = 4;
+	int ship_y = 0;
+	int prev_ship_x = 4; //ship column at the previous tick, for draw interpolation
+
+	int score = 0;
+	int lives = 3;
+	int game_over = 0;
+};
@@ -0,0 +1,15 @@
+#include "gl_extensions.hpp"
+
+#include "GL.hpp"
+
+#include <cstring>
+
+bool have_gl_extension(char const *name) {
+	GLint count = 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+	for (GLint i = 0; i < count; ++i) {
+		char const *ext = reinterpret_cast< char const * >(glGetStringi(GL_EXTENSIONS, GLuint(i)));
+		if (ext && 0 == strcmp(ext, name)) return true;
+	}
+	return false;
+}
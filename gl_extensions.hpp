@@ -0,0 +1,5 @@
+#pragma once
+
+//helper for runtime OpenGL extension queries (requires a current context):
+
+bool have_gl_extension(char const *name);
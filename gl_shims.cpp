@@ -7,6 +7,7 @@
 	PFNGL ## TYPE ## PROC gl ## NAME = NULL;
 #include "gl_shims.hpp"
 #undef DO
+#undef DO_OPTIONAL
 #undef GL_SHIMS_HPP
 
 void init_gl_shims() {
@@ -15,5 +16,9 @@ void init_gl_shims() {
 		if (!gl ## NAME) { \
 			throw std::runtime_error("Error binding "  "gl" #NAME); \
 		}
+	//optional (post-3.2) entry points stay NULL if the driver lacks them;
+	// callers are responsible for checking before use:
+	#define DO_OPTIONAL(TYPE, NAME) \
+		gl ## NAME = (PFNGL ## TYPE ## PROC)SDL_GL_GetProcAddress("gl" #NAME);
 #include "gl_shims.hpp"
 }
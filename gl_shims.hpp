@@ -72,6 +72,10 @@ GLAPI void APIENTRY glViewport (GLint x, GLint y, GLsizei width, GLsizei height)
 #define DO(TYPE, NAME) 	extern PFNGL ## TYPE ## PROC gl ## NAME;
 #endif
 
+#ifndef DO_OPTIONAL
+#define DO_OPTIONAL(TYPE, NAME) DO(TYPE, NAME)
+#endif
+
 
 
 // GL_VERSION_1_1 extensions:
@@ -134,6 +138,7 @@ DO(ISBUFFER, IsBuffer)
 DO(BUFFERDATA, BufferData)
 DO(BUFFERSUBDATA, BufferSubData)
 DO(GETBUFFERSUBDATA, GetBufferSubData)
+DO(MAPBUFFER, MapBuffer)
 DO(UNMAPBUFFER, UnmapBuffer)
 DO(GETBUFFERPARAMETERIV, GetBufferParameteriv)
 DO(GETBUFFERPOINTERV, GetBufferPointerv)
@@ -299,6 +304,7 @@ DO(CLEARBUFFERIV, ClearBufferiv)
 DO(CLEARBUFFERUIV, ClearBufferuiv)
 DO(CLEARBUFFERFV, ClearBufferfv)
 DO(CLEARBUFFERFI, ClearBufferfi)
+DO(GETSTRINGI, GetStringi)
 DO(ISRENDERBUFFER, IsRenderbuffer)
 DO(BINDRENDERBUFFER, BindRenderbuffer)
 DO(DELETERENDERBUFFERS, DeleteRenderbuffers)
@@ -319,6 +325,7 @@ DO(GENERATEMIPMAP, GenerateMipmap)
 DO(BLITFRAMEBUFFER, BlitFramebuffer)
 DO(RENDERBUFFERSTORAGEMULTISAMPLE, RenderbufferStorageMultisample)
 DO(FRAMEBUFFERTEXTURELAYER, FramebufferTextureLayer)
+DO(MAPBUFFERRANGE, MapBufferRange)
 DO(FLUSHMAPPEDBUFFERRANGE, FlushMappedBufferRange)
 DO(BINDVERTEXARRAY, BindVertexArray)
 DO(DELETEVERTEXARRAYS, DeleteVertexArrays)
@@ -360,4 +367,355 @@ DO(TEXIMAGE3DMULTISAMPLE, TexImage3DMultisample)
 DO(GETMULTISAMPLEFV, GetMultisamplefv)
 DO(SAMPLEMASKI, SampleMaski)
 
+
+// GL_VERSION_3_3 optional extensions:
+DO_OPTIONAL(BINDFRAGDATALOCATIONINDEXED, BindFragDataLocationIndexed)
+DO_OPTIONAL(GETFRAGDATAINDEX, GetFragDataIndex)
+DO_OPTIONAL(GENSAMPLERS, GenSamplers)
+DO_OPTIONAL(DELETESAMPLERS, DeleteSamplers)
+DO_OPTIONAL(ISSAMPLER, IsSampler)
+DO_OPTIONAL(BINDSAMPLER, BindSampler)
+DO_OPTIONAL(SAMPLERPARAMETERI, SamplerParameteri)
+DO_OPTIONAL(SAMPLERPARAMETERIV, SamplerParameteriv)
+DO_OPTIONAL(SAMPLERPARAMETERF, SamplerParameterf)
+DO_OPTIONAL(SAMPLERPARAMETERFV, SamplerParameterfv)
+DO_OPTIONAL(SAMPLERPARAMETERIIV, SamplerParameterIiv)
+DO_OPTIONAL(SAMPLERPARAMETERIUIV, SamplerParameterIuiv)
+DO_OPTIONAL(GETSAMPLERPARAMETERIV, GetSamplerParameteriv)
+DO_OPTIONAL(GETSAMPLERPARAMETERIIV, GetSamplerParameterIiv)
+DO_OPTIONAL(GETSAMPLERPARAMETERFV, GetSamplerParameterfv)
+DO_OPTIONAL(GETSAMPLERPARAMETERIUIV, GetSamplerParameterIuiv)
+DO_OPTIONAL(QUERYCOUNTER, QueryCounter)
+DO_OPTIONAL(GETQUERYOBJECTI64V, GetQueryObjecti64v)
+DO_OPTIONAL(GETQUERYOBJECTUI64V, GetQueryObjectui64v)
+DO_OPTIONAL(VERTEXATTRIBDIVISOR, VertexAttribDivisor)
+DO_OPTIONAL(VERTEXATTRIBP1UI, VertexAttribP1ui)
+DO_OPTIONAL(VERTEXATTRIBP1UIV, VertexAttribP1uiv)
+DO_OPTIONAL(VERTEXATTRIBP2UI, VertexAttribP2ui)
+DO_OPTIONAL(VERTEXATTRIBP2UIV, VertexAttribP2uiv)
+DO_OPTIONAL(VERTEXATTRIBP3UI, VertexAttribP3ui)
+DO_OPTIONAL(VERTEXATTRIBP3UIV, VertexAttribP3uiv)
+DO_OPTIONAL(VERTEXATTRIBP4UI, VertexAttribP4ui)
+DO_OPTIONAL(VERTEXATTRIBP4UIV, VertexAttribP4uiv)
+
+// GL_VERSION_4_0 optional extensions:
+DO_OPTIONAL(MINSAMPLESHADING, MinSampleShading)
+DO_OPTIONAL(BLENDEQUATIONI, BlendEquationi)
+DO_OPTIONAL(BLENDEQUATIONSEPARATEI, BlendEquationSeparatei)
+DO_OPTIONAL(BLENDFUNCI, BlendFunci)
+DO_OPTIONAL(BLENDFUNCSEPARATEI, BlendFuncSeparatei)
+DO_OPTIONAL(DRAWARRAYSINDIRECT, DrawArraysIndirect)
+DO_OPTIONAL(DRAWELEMENTSINDIRECT, DrawElementsIndirect)
+DO_OPTIONAL(UNIFORM1D, Uniform1d)
+DO_OPTIONAL(UNIFORM2D, Uniform2d)
+DO_OPTIONAL(UNIFORM3D, Uniform3d)
+DO_OPTIONAL(UNIFORM4D, Uniform4d)
+DO_OPTIONAL(UNIFORM1DV, Uniform1dv)
+DO_OPTIONAL(UNIFORM2DV, Uniform2dv)
+DO_OPTIONAL(UNIFORM3DV, Uniform3dv)
+DO_OPTIONAL(UNIFORM4DV, Uniform4dv)
+DO_OPTIONAL(UNIFORMMATRIX2DV, UniformMatrix2dv)
+DO_OPTIONAL(UNIFORMMATRIX3DV, UniformMatrix3dv)
+DO_OPTIONAL(UNIFORMMATRIX4DV, UniformMatrix4dv)
+DO_OPTIONAL(UNIFORMMATRIX2X3DV, UniformMatrix2x3dv)
+DO_OPTIONAL(UNIFORMMATRIX2X4DV, UniformMatrix2x4dv)
+DO_OPTIONAL(UNIFORMMATRIX3X2DV, UniformMatrix3x2dv)
+DO_OPTIONAL(UNIFORMMATRIX3X4DV, UniformMatrix3x4dv)
+DO_OPTIONAL(UNIFORMMATRIX4X2DV, UniformMatrix4x2dv)
+DO_OPTIONAL(UNIFORMMATRIX4X3DV, UniformMatrix4x3dv)
+DO_OPTIONAL(GETUNIFORMDV, GetUniformdv)
+DO_OPTIONAL(GETSUBROUTINEUNIFORMLOCATION, GetSubroutineUniformLocation)
+DO_OPTIONAL(GETSUBROUTINEINDEX, GetSubroutineIndex)
+DO_OPTIONAL(GETACTIVESUBROUTINEUNIFORMIV, GetActiveSubroutineUniformiv)
+DO_OPTIONAL(GETACTIVESUBROUTINEUNIFORMNAME, GetActiveSubroutineUniformName)
+DO_OPTIONAL(GETACTIVESUBROUTINENAME, GetActiveSubroutineName)
+DO_OPTIONAL(UNIFORMSUBROUTINESUIV, UniformSubroutinesuiv)
+DO_OPTIONAL(GETUNIFORMSUBROUTINEUIV, GetUniformSubroutineuiv)
+DO_OPTIONAL(GETPROGRAMSTAGEIV, GetProgramStageiv)
+DO_OPTIONAL(PATCHPARAMETERI, PatchParameteri)
+DO_OPTIONAL(PATCHPARAMETERFV, PatchParameterfv)
+DO_OPTIONAL(BINDTRANSFORMFEEDBACK, BindTransformFeedback)
+DO_OPTIONAL(DELETETRANSFORMFEEDBACKS, DeleteTransformFeedbacks)
+DO_OPTIONAL(GENTRANSFORMFEEDBACKS, GenTransformFeedbacks)
+DO_OPTIONAL(ISTRANSFORMFEEDBACK, IsTransformFeedback)
+DO_OPTIONAL(PAUSETRANSFORMFEEDBACK, PauseTransformFeedback)
+DO_OPTIONAL(RESUMETRANSFORMFEEDBACK, ResumeTransformFeedback)
+DO_OPTIONAL(DRAWTRANSFORMFEEDBACK, DrawTransformFeedback)
+DO_OPTIONAL(DRAWTRANSFORMFEEDBACKSTREAM, DrawTransformFeedbackStream)
+DO_OPTIONAL(BEGINQUERYINDEXED, BeginQueryIndexed)
+DO_OPTIONAL(ENDQUERYINDEXED, EndQueryIndexed)
+DO_OPTIONAL(GETQUERYINDEXEDIV, GetQueryIndexediv)
+
+// GL_VERSION_4_1 optional extensions:
+DO_OPTIONAL(RELEASESHADERCOMPILER, ReleaseShaderCompiler)
+DO_OPTIONAL(SHADERBINARY, ShaderBinary)
+DO_OPTIONAL(GETSHADERPRECISIONFORMAT, GetShaderPrecisionFormat)
+DO_OPTIONAL(DEPTHRANGEF, DepthRangef)
+DO_OPTIONAL(CLEARDEPTHF, ClearDepthf)
+DO_OPTIONAL(GETPROGRAMBINARY, GetProgramBinary)
+DO_OPTIONAL(PROGRAMBINARY, ProgramBinary)
+DO_OPTIONAL(PROGRAMPARAMETERI, ProgramParameteri)
+DO_OPTIONAL(USEPROGRAMSTAGES, UseProgramStages)
+DO_OPTIONAL(ACTIVESHADERPROGRAM, ActiveShaderProgram)
+DO_OPTIONAL(CREATESHADERPROGRAMV, CreateShaderProgramv)
+DO_OPTIONAL(BINDPROGRAMPIPELINE, BindProgramPipeline)
+DO_OPTIONAL(DELETEPROGRAMPIPELINES, DeleteProgramPipelines)
+DO_OPTIONAL(GENPROGRAMPIPELINES, GenProgramPipelines)
+DO_OPTIONAL(ISPROGRAMPIPELINE, IsProgramPipeline)
+DO_OPTIONAL(GETPROGRAMPIPELINEIV, GetProgramPipelineiv)
+DO_OPTIONAL(PROGRAMUNIFORM1I, ProgramUniform1i)
+DO_OPTIONAL(PROGRAMUNIFORM1IV, ProgramUniform1iv)
+DO_OPTIONAL(PROGRAMUNIFORM1F, ProgramUniform1f)
+DO_OPTIONAL(PROGRAMUNIFORM1FV, ProgramUniform1fv)
+DO_OPTIONAL(PROGRAMUNIFORM1D, ProgramUniform1d)
+DO_OPTIONAL(PROGRAMUNIFORM1DV, ProgramUniform1dv)
+DO_OPTIONAL(PROGRAMUNIFORM1UI, ProgramUniform1ui)
+DO_OPTIONAL(PROGRAMUNIFORM1UIV, ProgramUniform1uiv)
+DO_OPTIONAL(PROGRAMUNIFORM2I, ProgramUniform2i)
+DO_OPTIONAL(PROGRAMUNIFORM2IV, ProgramUniform2iv)
+DO_OPTIONAL(PROGRAMUNIFORM2F, ProgramUniform2f)
+DO_OPTIONAL(PROGRAMUNIFORM2FV, ProgramUniform2fv)
+DO_OPTIONAL(PROGRAMUNIFORM2D, ProgramUniform2d)
+DO_OPTIONAL(PROGRAMUNIFORM2DV, ProgramUniform2dv)
+DO_OPTIONAL(PROGRAMUNIFORM2UI, ProgramUniform2ui)
+DO_OPTIONAL(PROGRAMUNIFORM2UIV, ProgramUniform2uiv)
+DO_OPTIONAL(PROGRAMUNIFORM3I, ProgramUniform3i)
+DO_OPTIONAL(PROGRAMUNIFORM3IV, ProgramUniform3iv)
+DO_OPTIONAL(PROGRAMUNIFORM3F, ProgramUniform3f)
+DO_OPTIONAL(PROGRAMUNIFORM3FV, ProgramUniform3fv)
+DO_OPTIONAL(PROGRAMUNIFORM3D, ProgramUniform3d)
+DO_OPTIONAL(PROGRAMUNIFORM3DV, ProgramUniform3dv)
+DO_OPTIONAL(PROGRAMUNIFORM3UI, ProgramUniform3ui)
+DO_OPTIONAL(PROGRAMUNIFORM3UIV, ProgramUniform3uiv)
+DO_OPTIONAL(PROGRAMUNIFORM4I, ProgramUniform4i)
+DO_OPTIONAL(PROGRAMUNIFORM4IV, ProgramUniform4iv)
+DO_OPTIONAL(PROGRAMUNIFORM4F, ProgramUniform4f)
+DO_OPTIONAL(PROGRAMUNIFORM4FV, ProgramUniform4fv)
+DO_OPTIONAL(PROGRAMUNIFORM4D, ProgramUniform4d)
+DO_OPTIONAL(PROGRAMUNIFORM4DV, ProgramUniform4dv)
+DO_OPTIONAL(PROGRAMUNIFORM4UI, ProgramUniform4ui)
+DO_OPTIONAL(PROGRAMUNIFORM4UIV, ProgramUniform4uiv)
+DO_OPTIONAL(PROGRAMUNIFORMMATRIX2FV, ProgramUniformMatrix2fv)
+DO_OPTIONAL(PROGRAMUNIFORMMATRIX3FV, ProgramUniformMatrix3fv)
+DO_OPTIONAL(PROGRAMUNIFORMMATRIX4FV, ProgramUniformMatrix4fv)
+DO_OPTIONAL(PROGRAMUNIFORMMATRIX2DV, ProgramUniformMatrix2dv)
+DO_OPTIONAL(PROGRAMUNIFORMMATRIX3DV, ProgramUniformMatrix3dv)
+DO_OPTIONAL(PROGRAMUNIFORMMATRIX4DV, ProgramUniformMatrix4dv)
+DO_OPTIONAL(PROGRAMUNIFORMMATRIX2X3FV, ProgramUniformMatrix2x3fv)
+DO_OPTIONAL(PROGRAMUNIFORMMATRIX3X2FV, ProgramUniformMatrix3x2fv)
+DO_OPTIONAL(PROGRAMUNIFORMMATRIX2X4FV, ProgramUniformMatrix2x4fv)
+DO_OPTIONAL(PROGRAMUNIFORMMATRIX4X2FV, ProgramUniformMatrix4x2fv)
+DO_OPTIONAL(PROGRAMUNIFORMMATRIX3X4FV, ProgramUniformMatrix3x4fv)
+DO_OPTIONAL(PROGRAMUNIFORMMATRIX4X3FV, ProgramUniformMatrix4x3fv)
+DO_OPTIONAL(PROGRAMUNIFORMMATRIX2X3DV, ProgramUniformMatrix2x3dv)
+DO_OPTIONAL(PROGRAMUNIFORMMATRIX3X2DV, ProgramUniformMatrix3x2dv)
+DO_OPTIONAL(PROGRAMUNIFORMMATRIX2X4DV, ProgramUniformMatrix2x4dv)
+DO_OPTIONAL(PROGRAMUNIFORMMATRIX4X2DV, ProgramUniformMatrix4x2dv)
+DO_OPTIONAL(PROGRAMUNIFORMMATRIX3X4DV, ProgramUniformMatrix3x4dv)
+DO_OPTIONAL(PROGRAMUNIFORMMATRIX4X3DV, ProgramUniformMatrix4x3dv)
+DO_OPTIONAL(VALIDATEPROGRAMPIPELINE, ValidateProgramPipeline)
+DO_OPTIONAL(GETPROGRAMPIPELINEINFOLOG, GetProgramPipelineInfoLog)
+DO_OPTIONAL(VERTEXATTRIBL1D, VertexAttribL1d)
+DO_OPTIONAL(VERTEXATTRIBL2D, VertexAttribL2d)
+DO_OPTIONAL(VERTEXATTRIBL3D, VertexAttribL3d)
+DO_OPTIONAL(VERTEXATTRIBL4D, VertexAttribL4d)
+DO_OPTIONAL(VERTEXATTRIBL1DV, VertexAttribL1dv)
+DO_OPTIONAL(VERTEXATTRIBL2DV, VertexAttribL2dv)
+DO_OPTIONAL(VERTEXATTRIBL3DV, VertexAttribL3dv)
+DO_OPTIONAL(VERTEXATTRIBL4DV, VertexAttribL4dv)
+DO_OPTIONAL(VERTEXATTRIBLPOINTER, VertexAttribLPointer)
+DO_OPTIONAL(GETVERTEXATTRIBLDV, GetVertexAttribLdv)
+DO_OPTIONAL(VIEWPORTARRAYV, ViewportArrayv)
+DO_OPTIONAL(VIEWPORTINDEXEDF, ViewportIndexedf)
+DO_OPTIONAL(VIEWPORTINDEXEDFV, ViewportIndexedfv)
+DO_OPTIONAL(SCISSORARRAYV, ScissorArrayv)
+DO_OPTIONAL(SCISSORINDEXED, ScissorIndexed)
+DO_OPTIONAL(SCISSORINDEXEDV, ScissorIndexedv)
+DO_OPTIONAL(DEPTHRANGEARRAYV, DepthRangeArrayv)
+DO_OPTIONAL(DEPTHRANGEINDEXED, DepthRangeIndexed)
+DO_OPTIONAL(GETFLOATI_V, GetFloati_v)
+DO_OPTIONAL(GETDOUBLEI_V, GetDoublei_v)
+
+// GL_VERSION_4_2 optional extensions:
+DO_OPTIONAL(DRAWARRAYSINSTANCEDBASEINSTANCE, DrawArraysInstancedBaseInstance)
+DO_OPTIONAL(DRAWELEMENTSINSTANCEDBASEINSTANCE, DrawElementsInstancedBaseInstance)
+DO_OPTIONAL(DRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCE, DrawElementsInstancedBaseVertexBaseInstance)
+DO_OPTIONAL(GETINTERNALFORMATIV, GetInternalformativ)
+DO_OPTIONAL(GETACTIVEATOMICCOUNTERBUFFERIV, GetActiveAtomicCounterBufferiv)
+DO_OPTIONAL(BINDIMAGETEXTURE, BindImageTexture)
+DO_OPTIONAL(MEMORYBARRIER, MemoryBarrier)
+DO_OPTIONAL(TEXSTORAGE1D, TexStorage1D)
+DO_OPTIONAL(TEXSTORAGE2D, TexStorage2D)
+DO_OPTIONAL(TEXSTORAGE3D, TexStorage3D)
+DO_OPTIONAL(DRAWTRANSFORMFEEDBACKINSTANCED, DrawTransformFeedbackInstanced)
+DO_OPTIONAL(DRAWTRANSFORMFEEDBACKSTREAMINSTANCED, DrawTransformFeedbackStreamInstanced)
+
+// GL_VERSION_4_3 optional extensions:
+DO_OPTIONAL(CLEARBUFFERDATA, ClearBufferData)
+DO_OPTIONAL(CLEARBUFFERSUBDATA, ClearBufferSubData)
+DO_OPTIONAL(DISPATCHCOMPUTE, DispatchCompute)
+DO_OPTIONAL(DISPATCHCOMPUTEINDIRECT, DispatchComputeIndirect)
+DO_OPTIONAL(COPYIMAGESUBDATA, CopyImageSubData)
+DO_OPTIONAL(FRAMEBUFFERPARAMETERI, FramebufferParameteri)
+DO_OPTIONAL(GETFRAMEBUFFERPARAMETERIV, GetFramebufferParameteriv)
+DO_OPTIONAL(GETINTERNALFORMATI64V, GetInternalformati64v)
+DO_OPTIONAL(INVALIDATETEXSUBIMAGE, InvalidateTexSubImage)
+DO_OPTIONAL(INVALIDATETEXIMAGE, InvalidateTexImage)
+DO_OPTIONAL(INVALIDATEBUFFERSUBDATA, InvalidateBufferSubData)
+DO_OPTIONAL(INVALIDATEBUFFERDATA, InvalidateBufferData)
+DO_OPTIONAL(INVALIDATEFRAMEBUFFER, InvalidateFramebuffer)
+DO_OPTIONAL(INVALIDATESUBFRAMEBUFFER, InvalidateSubFramebuffer)
+DO_OPTIONAL(MULTIDRAWARRAYSINDIRECT, MultiDrawArraysIndirect)
+DO_OPTIONAL(MULTIDRAWELEMENTSINDIRECT, MultiDrawElementsIndirect)
+DO_OPTIONAL(GETPROGRAMINTERFACEIV, GetProgramInterfaceiv)
+DO_OPTIONAL(GETPROGRAMRESOURCEINDEX, GetProgramResourceIndex)
+DO_OPTIONAL(GETPROGRAMRESOURCENAME, GetProgramResourceName)
+DO_OPTIONAL(GETPROGRAMRESOURCEIV, GetProgramResourceiv)
+DO_OPTIONAL(GETPROGRAMRESOURCELOCATION, GetProgramResourceLocation)
+DO_OPTIONAL(GETPROGRAMRESOURCELOCATIONINDEX, GetProgramResourceLocationIndex)
+DO_OPTIONAL(SHADERSTORAGEBLOCKBINDING, ShaderStorageBlockBinding)
+DO_OPTIONAL(TEXBUFFERRANGE, TexBufferRange)
+DO_OPTIONAL(TEXSTORAGE2DMULTISAMPLE, TexStorage2DMultisample)
+DO_OPTIONAL(TEXSTORAGE3DMULTISAMPLE, TexStorage3DMultisample)
+DO_OPTIONAL(TEXTUREVIEW, TextureView)
+DO_OPTIONAL(BINDVERTEXBUFFER, BindVertexBuffer)
+DO_OPTIONAL(VERTEXATTRIBFORMAT, VertexAttribFormat)
+DO_OPTIONAL(VERTEXATTRIBIFORMAT, VertexAttribIFormat)
+DO_OPTIONAL(VERTEXATTRIBLFORMAT, VertexAttribLFormat)
+DO_OPTIONAL(VERTEXATTRIBBINDING, VertexAttribBinding)
+DO_OPTIONAL(VERTEXBINDINGDIVISOR, VertexBindingDivisor)
+DO_OPTIONAL(DEBUGMESSAGECONTROL, DebugMessageControl)
+DO_OPTIONAL(DEBUGMESSAGEINSERT, DebugMessageInsert)
+DO_OPTIONAL(DEBUGMESSAGECALLBACK, DebugMessageCallback)
+DO_OPTIONAL(GETDEBUGMESSAGELOG, GetDebugMessageLog)
+DO_OPTIONAL(PUSHDEBUGGROUP, PushDebugGroup)
+DO_OPTIONAL(POPDEBUGGROUP, PopDebugGroup)
+DO_OPTIONAL(OBJECTLABEL, ObjectLabel)
+DO_OPTIONAL(GETOBJECTLABEL, GetObjectLabel)
+DO_OPTIONAL(OBJECTPTRLABEL, ObjectPtrLabel)
+DO_OPTIONAL(GETOBJECTPTRLABEL, GetObjectPtrLabel)
+
+// GL_VERSION_4_4 optional extensions:
+DO_OPTIONAL(BUFFERSTORAGE, BufferStorage)
+DO_OPTIONAL(CLEARTEXIMAGE, ClearTexImage)
+DO_OPTIONAL(CLEARTEXSUBIMAGE, ClearTexSubImage)
+DO_OPTIONAL(BINDBUFFERSBASE, BindBuffersBase)
+DO_OPTIONAL(BINDBUFFERSRANGE, BindBuffersRange)
+DO_OPTIONAL(BINDTEXTURES, BindTextures)
+DO_OPTIONAL(BINDSAMPLERS, BindSamplers)
+DO_OPTIONAL(BINDIMAGETEXTURES, BindImageTextures)
+DO_OPTIONAL(BINDVERTEXBUFFERS, BindVertexBuffers)
+
+// GL_VERSION_4_5 optional extensions:
+DO_OPTIONAL(CLIPCONTROL, ClipControl)
+DO_OPTIONAL(CREATETRANSFORMFEEDBACKS, CreateTransformFeedbacks)
+DO_OPTIONAL(TRANSFORMFEEDBACKBUFFERBASE, TransformFeedbackBufferBase)
+DO_OPTIONAL(TRANSFORMFEEDBACKBUFFERRANGE, TransformFeedbackBufferRange)
+DO_OPTIONAL(GETTRANSFORMFEEDBACKIV, GetTransformFeedbackiv)
+DO_OPTIONAL(GETTRANSFORMFEEDBACKI_V, GetTransformFeedbacki_v)
+DO_OPTIONAL(GETTRANSFORMFEEDBACKI64_V, GetTransformFeedbacki64_v)
+DO_OPTIONAL(CREATEBUFFERS, CreateBuffers)
+DO_OPTIONAL(NAMEDBUFFERSTORAGE, NamedBufferStorage)
+DO_OPTIONAL(NAMEDBUFFERDATA, NamedBufferData)
+DO_OPTIONAL(NAMEDBUFFERSUBDATA, NamedBufferSubData)
+DO_OPTIONAL(COPYNAMEDBUFFERSUBDATA, CopyNamedBufferSubData)
+DO_OPTIONAL(CLEARNAMEDBUFFERDATA, ClearNamedBufferData)
+DO_OPTIONAL(CLEARNAMEDBUFFERSUBDATA, ClearNamedBufferSubData)
+DO_OPTIONAL(MAPNAMEDBUFFER, MapNamedBuffer)
+DO_OPTIONAL(MAPNAMEDBUFFERRANGE, MapNamedBufferRange)
+DO_OPTIONAL(UNMAPNAMEDBUFFER, UnmapNamedBuffer)
+DO_OPTIONAL(FLUSHMAPPEDNAMEDBUFFERRANGE, FlushMappedNamedBufferRange)
+DO_OPTIONAL(GETNAMEDBUFFERPARAMETERIV, GetNamedBufferParameteriv)
+DO_OPTIONAL(GETNAMEDBUFFERPARAMETERI64V, GetNamedBufferParameteri64v)
+DO_OPTIONAL(GETNAMEDBUFFERPOINTERV, GetNamedBufferPointerv)
+DO_OPTIONAL(GETNAMEDBUFFERSUBDATA, GetNamedBufferSubData)
+DO_OPTIONAL(CREATEFRAMEBUFFERS, CreateFramebuffers)
+DO_OPTIONAL(NAMEDFRAMEBUFFERRENDERBUFFER, NamedFramebufferRenderbuffer)
+DO_OPTIONAL(NAMEDFRAMEBUFFERPARAMETERI, NamedFramebufferParameteri)
+DO_OPTIONAL(NAMEDFRAMEBUFFERTEXTURE, NamedFramebufferTexture)
+DO_OPTIONAL(NAMEDFRAMEBUFFERTEXTURELAYER, NamedFramebufferTextureLayer)
+DO_OPTIONAL(NAMEDFRAMEBUFFERDRAWBUFFER, NamedFramebufferDrawBuffer)
+DO_OPTIONAL(NAMEDFRAMEBUFFERDRAWBUFFERS, NamedFramebufferDrawBuffers)
+DO_OPTIONAL(NAMEDFRAMEBUFFERREADBUFFER, NamedFramebufferReadBuffer)
+DO_OPTIONAL(INVALIDATENAMEDFRAMEBUFFERDATA, InvalidateNamedFramebufferData)
+DO_OPTIONAL(INVALIDATENAMEDFRAMEBUFFERSUBDATA, InvalidateNamedFramebufferSubData)
+DO_OPTIONAL(CLEARNAMEDFRAMEBUFFERIV, ClearNamedFramebufferiv)
+DO_OPTIONAL(CLEARNAMEDFRAMEBUFFERUIV, ClearNamedFramebufferuiv)
+DO_OPTIONAL(CLEARNAMEDFRAMEBUFFERFV, ClearNamedFramebufferfv)
+DO_OPTIONAL(CLEARNAMEDFRAMEBUFFERFI, ClearNamedFramebufferfi)
+DO_OPTIONAL(BLITNAMEDFRAMEBUFFER, BlitNamedFramebuffer)
+DO_OPTIONAL(CHECKNAMEDFRAMEBUFFERSTATUS, CheckNamedFramebufferStatus)
+DO_OPTIONAL(GETNAMEDFRAMEBUFFERPARAMETERIV, GetNamedFramebufferParameteriv)
+DO_OPTIONAL(GETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIV, GetNamedFramebufferAttachmentParameteriv)
+DO_OPTIONAL(CREATERENDERBUFFERS, CreateRenderbuffers)
+DO_OPTIONAL(NAMEDRENDERBUFFERSTORAGE, NamedRenderbufferStorage)
+DO_OPTIONAL(NAMEDRENDERBUFFERSTORAGEMULTISAMPLE, NamedRenderbufferStorageMultisample)
+DO_OPTIONAL(GETNAMEDRENDERBUFFERPARAMETERIV, GetNamedRenderbufferParameteriv)
+DO_OPTIONAL(CREATETEXTURES, CreateTextures)
+DO_OPTIONAL(TEXTUREBUFFER, TextureBuffer)
+DO_OPTIONAL(TEXTUREBUFFERRANGE, TextureBufferRange)
+DO_OPTIONAL(TEXTURESTORAGE1D, TextureStorage1D)
+DO_OPTIONAL(TEXTURESTORAGE2D, TextureStorage2D)
+DO_OPTIONAL(TEXTURESTORAGE3D, TextureStorage3D)
+DO_OPTIONAL(TEXTURESTORAGE2DMULTISAMPLE, TextureStorage2DMultisample)
+DO_OPTIONAL(TEXTURESTORAGE3DMULTISAMPLE, TextureStorage3DMultisample)
+DO_OPTIONAL(TEXTURESUBIMAGE1D, TextureSubImage1D)
+DO_OPTIONAL(TEXTURESUBIMAGE2D, TextureSubImage2D)
+DO_OPTIONAL(TEXTURESUBIMAGE3D, TextureSubImage3D)
+DO_OPTIONAL(COMPRESSEDTEXTURESUBIMAGE1D, CompressedTextureSubImage1D)
+DO_OPTIONAL(COMPRESSEDTEXTURESUBIMAGE2D, CompressedTextureSubImage2D)
+DO_OPTIONAL(COMPRESSEDTEXTURESUBIMAGE3D, CompressedTextureSubImage3D)
+DO_OPTIONAL(COPYTEXTURESUBIMAGE1D, CopyTextureSubImage1D)
+DO_OPTIONAL(COPYTEXTURESUBIMAGE2D, CopyTextureSubImage2D)
+DO_OPTIONAL(COPYTEXTURESUBIMAGE3D, CopyTextureSubImage3D)
+DO_OPTIONAL(TEXTUREPARAMETERF, TextureParameterf)
+DO_OPTIONAL(TEXTUREPARAMETERFV, TextureParameterfv)
+DO_OPTIONAL(TEXTUREPARAMETERI, TextureParameteri)
+DO_OPTIONAL(TEXTUREPARAMETERIIV, TextureParameterIiv)
+DO_OPTIONAL(TEXTUREPARAMETERIUIV, TextureParameterIuiv)
+DO_OPTIONAL(TEXTUREPARAMETERIV, TextureParameteriv)
+DO_OPTIONAL(GENERATETEXTUREMIPMAP, GenerateTextureMipmap)
+DO_OPTIONAL(BINDTEXTUREUNIT, BindTextureUnit)
+DO_OPTIONAL(GETTEXTUREIMAGE, GetTextureImage)
+DO_OPTIONAL(GETCOMPRESSEDTEXTUREIMAGE, GetCompressedTextureImage)
+DO_OPTIONAL(GETTEXTURELEVELPARAMETERFV, GetTextureLevelParameterfv)
+DO_OPTIONAL(GETTEXTURELEVELPARAMETERIV, GetTextureLevelParameteriv)
+DO_OPTIONAL(GETTEXTUREPARAMETERFV, GetTextureParameterfv)
+DO_OPTIONAL(GETTEXTUREPARAMETERIIV, GetTextureParameterIiv)
+DO_OPTIONAL(GETTEXTUREPARAMETERIUIV, GetTextureParameterIuiv)
+DO_OPTIONAL(GETTEXTUREPARAMETERIV, GetTextureParameteriv)
+DO_OPTIONAL(CREATEVERTEXARRAYS, CreateVertexArrays)
+DO_OPTIONAL(DISABLEVERTEXARRAYATTRIB, DisableVertexArrayAttrib)
+DO_OPTIONAL(ENABLEVERTEXARRAYATTRIB, EnableVertexArrayAttrib)
+DO_OPTIONAL(VERTEXARRAYELEMENTBUFFER, VertexArrayElementBuffer)
+DO_OPTIONAL(VERTEXARRAYVERTEXBUFFER, VertexArrayVertexBuffer)
+DO_OPTIONAL(VERTEXARRAYVERTEXBUFFERS, VertexArrayVertexBuffers)
+DO_OPTIONAL(VERTEXARRAYATTRIBBINDING, VertexArrayAttribBinding)
+DO_OPTIONAL(VERTEXARRAYATTRIBFORMAT, VertexArrayAttribFormat)
+DO_OPTIONAL(VERTEXARRAYATTRIBIFORMAT, VertexArrayAttribIFormat)
+DO_OPTIONAL(VERTEXARRAYATTRIBLFORMAT, VertexArrayAttribLFormat)
+DO_OPTIONAL(VERTEXARRAYBINDINGDIVISOR, VertexArrayBindingDivisor)
+DO_OPTIONAL(GETVERTEXARRAYIV, GetVertexArrayiv)
+DO_OPTIONAL(GETVERTEXARRAYINDEXEDIV, GetVertexArrayIndexediv)
+DO_OPTIONAL(GETVERTEXARRAYINDEXED64IV, GetVertexArrayIndexed64iv)
+DO_OPTIONAL(CREATESAMPLERS, CreateSamplers)
+DO_OPTIONAL(CREATEPROGRAMPIPELINES, CreateProgramPipelines)
+DO_OPTIONAL(CREATEQUERIES, CreateQueries)
+DO_OPTIONAL(GETQUERYBUFFEROBJECTI64V, GetQueryBufferObjecti64v)
+DO_OPTIONAL(GETQUERYBUFFEROBJECTIV, GetQueryBufferObjectiv)
+DO_OPTIONAL(GETQUERYBUFFEROBJECTUI64V, GetQueryBufferObjectui64v)
+DO_OPTIONAL(GETQUERYBUFFEROBJECTUIV, GetQueryBufferObjectuiv)
+DO_OPTIONAL(MEMORYBARRIERBYREGION, MemoryBarrierByRegion)
+DO_OPTIONAL(GETTEXTURESUBIMAGE, GetTextureSubImage)
+DO_OPTIONAL(GETCOMPRESSEDTEXTURESUBIMAGE, GetCompressedTextureSubImage)
+DO_OPTIONAL(GETGRAPHICSRESETSTATUS, GetGraphicsResetStatus)
+DO_OPTIONAL(GETNCOMPRESSEDTEXIMAGE, GetnCompressedTexImage)
+DO_OPTIONAL(GETNTEXIMAGE, GetnTexImage)
+DO_OPTIONAL(GETNUNIFORMDV, GetnUniformdv)
+DO_OPTIONAL(GETNUNIFORMFV, GetnUniformfv)
+DO_OPTIONAL(GETNUNIFORMIV, GetnUniformiv)
+DO_OPTIONAL(GETNUNIFORMUIV, GetnUniformuiv)
+DO_OPTIONAL(READNPIXELS, ReadnPixels)
+DO_OPTIONAL(TEXTUREBARRIER, TextureBarrier)
+
 #endif //GL_SHIMS_HPP
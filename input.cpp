@@ -0,0 +1,37 @@
+#include "input.hpp"
+
+#include <cstring>
+
+InputMapper::InputMapper() {
+	memset(bindings, None, sizeof(bindings));
+	bind(SDL_SCANCODE_LEFT, InputSnapshot::Left);
+	bind(SDL_SCANCODE_RIGHT, InputSnapshot::Right);
+	//second player (split-screen mode):
+	bind(SDL_SCANCODE_A, InputSnapshot::Left2);
+	bind(SDL_SCANCODE_D, InputSnapshot::Right2);
+}
+
+void InputMapper::bind(SDL_Scancode scancode, InputSnapshot::Button button) {
+	bindings[scancode] = uint8_t(button);
+}
+
+void InputMapper::gather(SDL_Event const *events, uint32_t count, InputSnapshot *snapshot) const {
+	for (uint32_t i = 0; i < count; ++i) {
+		SDL_Event const &evt = events[i];
+		if (evt.type != SDL_KEYDOWN && evt.type != SDL_KEYUP) continue;
+		//ignore any keys that are the result of automatic key repeat:
+		if (evt.type == SDL_KEYDOWN && evt.key.repeat) continue;
+
+		uint8_t button = bindings[evt.key.keysym.scancode];
+		if (button == None) continue;
+
+		uint8_t bit = uint8_t(1 << button);
+		if (evt.type == SDL_KEYDOWN) {
+			snapshot->held |= bit;
+			snapshot->pressed |= bit;
+		} else {
+			snapshot->held &= uint8_t(~bit);
+			snapshot->released |= bit;
+		}
+	}
+}
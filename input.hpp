@@ -0,0 +1,64 @@
+#pragma once
+
+#include <SDL.h>
+
+#include <cstdint>
+
+// Batched input layer: instead of dispatching into the game once per SDL
+// event, main.cpp drains the event queue into a frame-local buffer and
+// InputMapper::gather folds the whole batch into an InputSnapshot in one
+// pass. Game::update reads the snapshot; it never sees raw events, so
+// thousands of injected events per frame cost one table lookup each.
+
+//InputSnapshot is a bitset of logical buttons plus the edge transitions
+// accumulated since the edges were last cleared:
+struct InputSnapshot {
+	enum Button : uint8_t {
+		Left = 0,
+		Right = 1,
+		//second player, for the split-screen head-to-head mode; the second
+		// board sees these through for_player(), which shifts them down to
+		// Left/Right so GameState::step stays player-agnostic:
+		Left2 = 2,
+		Right2 = 3,
+		ButtonCount
+	};
+
+	uint8_t held = 0; //buttons currently down
+	uint8_t pressed = 0; //went down since clear_edges()
+	uint8_t released = 0; //went up since clear_edges()
+
+	bool is_held(Button button) const { return held & (1 << button); }
+	bool was_pressed(Button button) const { return pressed & (1 << button); }
+	bool was_released(Button button) const { return released & (1 << button); }
+
+	//edges are consumed per simulation tick (held state persists), so a
+	// single key press moves the ship once even when several ticks run in
+	// one frame:
+	void clear_edges() { pressed = 0; released = 0; }
+
+	//this snapshot as seen by player 'player' (0 or 1): player 1's buttons
+	// (Left2/Right2) shift down into Left/Right:
+	InputSnapshot for_player(uint8_t player) const {
+		InputSnapshot out;
+		out.held = uint8_t((held >> (2 * player)) & 0x3);
+		out.pressed = uint8_t((pressed >> (2 * player)) & 0x3);
+		out.released = uint8_t((released >> (2 * player)) & 0x3);
+		return out;
+	}
+};
+
+//InputMapper owns the scancode -> button remapping table (arrow keys by
+// default) and turns event batches into snapshot updates:
+struct InputMapper {
+	InputMapper();
+
+	//map 'scancode' to 'button' (a scancode maps to at most one button):
+	void bind(SDL_Scancode scancode, InputSnapshot::Button button);
+
+	//fold 'count' events into 'snapshot'; key repeats are ignored:
+	void gather(SDL_Event const *events, uint32_t count, InputSnapshot *snapshot) const;
+
+	uint8_t bindings[SDL_NUM_SCANCODES]; //button index, or None for unbound keys
+	enum : uint8_t { None = 0xff };
+};
@@ -1,9 +1,36 @@
 //Game.hpp declares the "game" object, which handles game-specific stuff:
 #include "Game.hpp"
 
+//batch_runner.hpp steps many GameState instances across all cores:
+#include "batch_runner.hpp"
+
+//frame_profiler.hpp declares the per-frame CPU/GPU timing instrumentation:
+#include "frame_profiler.hpp"
+
+//startup_profiler.hpp declares the launch-time phase timers:
+#include "startup_profiler.hpp"
+
+//replay.hpp declares the input record/replay log reader and writer:
+#include "replay.hpp"
+
+//input.hpp declares the batched event -> snapshot input layer:
+#include "input.hpp"
+
+//frame_arena.hpp declares the bump allocator for one-frame draw data:
+#include "frame_arena.hpp"
+
+//frame_pacer.hpp declares the vsync/uncapped/target-FPS present pacing:
+#include "frame_pacer.hpp"
+
+//data_path.hpp locates files next to the executable (for the profile dump):
+#include "data_path.hpp"
+
 //GL.hpp will include a non-namespace-polluting set of opengl prototypes:
 #include "GL.hpp"
 
+//spsc_slot.hpp declares the wait-free snapshot mailbox for the sim thread:
+#include "spsc_slot.hpp"
+
 //Includes for libSDL:
 #include <SDL.h>
 
@@ -19,6 +46,82 @@
 #include <fstream>
 #include <memory>
 #include <algorithm>
+#include <cstdlib>
+#include <thread>
+#include <mutex>
+#include <atomic>
+
+//run the simulation without a window or GL, driving scripted input as fast as
+// possible, and report throughput (for CI benchmarks of the update logic):
+static int run_headless(uint64_t ticks) {
+	GameState state; //simulation only; no GL resources at all
+
+	uint32_t rng = 0x12345678; //xorshift32; deterministic scripted input
+	InputSnapshot input;
+	auto before = std::chrono::high_resolution_clock::now();
+	for (uint64_t t = 0; t < ticks; ++t) {
+		rng ^= rng << 13;
+		rng ^= rng >> 17;
+		rng ^= rng << 5;
+		input.clear_edges();
+		input.pressed = uint8_t(1 << ((rng & 1) ? InputSnapshot::Right : InputSnapshot::Left));
+
+		state.step(input);
+
+		if (state.game_over) { //restart so the benchmark keeps simulating:
+			state.score = 0;
+			state.lives = 3;
+			state.game_over = 0;
+		}
+	}
+	auto after = std::chrono::high_resolution_clock::now();
+
+	double seconds = std::chrono::duration< double >(after - before).count();
+	std::cout << ticks << " ticks in " << seconds << " s ("
+		<< uint64_t(double(ticks) / seconds) << " ticks/s)." << std::endl;
+	return 0;
+}
+
+//step 'instances' independent games for 'ticks' ticks each across all cores
+// (for bot training and soak testing) and report aggregate throughput:
+static int run_batch_bench(uint32_t instances, uint64_t ticks) {
+	std::vector< GameState > states;
+	states.reserve(instances);
+	for (uint32_t i = 0; i < instances; ++i) {
+		states.emplace_back(GameState::DefaultSeed + i);
+	}
+
+	auto before = std::chrono::high_resolution_clock::now();
+	run_batch(states.data(), instances, ticks,
+		[](GameState &state, uint32_t instance, uint64_t tick) -> InputSnapshot {
+			if (state.game_over) { //restart so every instance keeps simulating:
+				state.score = 0;
+				state.lives = 3;
+				state.game_over = 0;
+			}
+			//cheap deterministic per-instance scripted input:
+			uint32_t rng = uint32_t(instance * 0x9e3779b9u) ^ uint32_t(tick);
+			rng ^= rng << 13;
+			rng ^= rng >> 17;
+			rng ^= rng << 5;
+			InputSnapshot input;
+			input.pressed = uint8_t(1 << ((rng & 1) ? InputSnapshot::Right : InputSnapshot::Left));
+			return input;
+		});
+	auto after = std::chrono::high_resolution_clock::now();
+
+	//sum the scores so the work can't be optimized away (and as a cheap
+	// cross-build determinism check):
+	uint64_t total_score = 0;
+	for (GameState const &state : states) total_score += uint64_t(state.score);
+
+	double seconds = std::chrono::duration< double >(after - before).count();
+	uint64_t total_ticks = uint64_t(instances) * ticks;
+	std::cout << instances << " instances x " << ticks << " ticks in " << seconds << " s ("
+		<< uint64_t(double(total_ticks) / seconds) << " ticks/s aggregate; score sum "
+		<< total_score << ")." << std::endl;
+	return 0;
+}
 
 int main(int argc, char **argv) {
 	struct {
@@ -26,10 +129,78 @@ int main(int argc, char **argv) {
 		glm::uvec2 size = glm::uvec2(640, 400);
 	} config;
 
+	//--headless N: benchmark N update ticks with no video/GL initialization at all.
+	//--batch I N: step I game instances N ticks each across all cores.
+	//--record F: play normally, logging the seed + per-tick controls to F.
+	//--replay F: play F back as fast as the GPU allows (vsync off), one tick
+	// per frame, so a recorded session doubles as a reproducible benchmark.
+	//--versus: split-screen head-to-head; a second board (A/D keys) renders in
+	// the right half of the window, sharing every GL resource with the first.
+	//--fps N: cap presentation at N frames per second with vsync off, sleeping
+	// (not spinning) between frames; for displays/builds where vsync is wrong.
+	//--uncapped: vsync off, no pacing at all (burns a core; for benchmarks).
+	std::unique_ptr< ReplayWriter > record;
+	std::unique_ptr< ReplayReader > replay;
+	bool versus = false;
+	float fps_cap = 0.0f;
+	bool uncapped = false;
+	for (int a = 1; a < argc; ++a) {
+		std::string arg = argv[a];
+		if (arg == "--headless") {
+			if (a + 1 >= argc) {
+				std::cerr << "Usage: " << argv[0] << " --headless <ticks>" << std::endl;
+				return 1;
+			}
+			return run_headless(strtoull(argv[a+1], nullptr, 10));
+		} else if (arg == "--batch") {
+			if (a + 2 >= argc) {
+				std::cerr << "Usage: " << argv[0] << " --batch <instances> <ticks>" << std::endl;
+				return 1;
+			}
+			return run_batch_bench(
+				uint32_t(strtoul(argv[a+1], nullptr, 10)),
+				strtoull(argv[a+2], nullptr, 10));
+		} else if (arg == "--record") {
+			if (a + 1 >= argc) {
+				std::cerr << "Usage: " << argv[0] << " --record <file>" << std::endl;
+				return 1;
+			}
+			record.reset(new ReplayWriter(argv[++a], Game::DefaultSeed));
+		} else if (arg == "--replay") {
+			if (a + 1 >= argc) {
+				std::cerr << "Usage: " << argv[0] << " --replay <file>" << std::endl;
+				return 1;
+			}
+			replay.reset(new ReplayReader(argv[++a]));
+		} else if (arg == "--versus") {
+			versus = true;
+		} else if (arg == "--fps") {
+			if (a + 1 >= argc) {
+				std::cerr << "Usage: " << argv[0] << " --fps <target>" << std::endl;
+				return 1;
+			}
+			fps_cap = strtof(argv[++a], nullptr);
+			if (!(fps_cap > 0.0f)) {
+				std::cerr << "--fps target must be positive." << std::endl;
+				return 1;
+			}
+		} else if (arg == "--uncapped") {
+			uncapped = true;
+		}
+	}
+
+	if (versus) {
+		//two boards side by side want twice the width:
+		config.size.x *= 2;
+	}
+
 	//------------  initialization ------------
 
 	//Initialize SDL library:
-	SDL_Init(SDL_INIT_VIDEO);
+	{
+		StartupPhase phase("sdl video init");
+		SDL_Init(SDL_INIT_VIDEO);
+	}
 
 	//Ask for an OpenGL context version 3.3, core profile, enable debug:
 	SDL_GL_ResetAttributes();
@@ -46,6 +217,7 @@ int main(int argc, char **argv) {
 	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
 
 	//create window:
+	StartupPhase window_phase("window + gl context");
 	SDL_Window *window = SDL_CreateWindow(
 		config.title.c_str(),
 		SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
@@ -74,13 +246,28 @@ int main(int argc, char **argv) {
 	//On windows, load OpenGL extensions:
 	init_gl_shims();
 	#endif
-
-	//Set VSYNC + Late Swap (prevents crazy FPS):
-	if (SDL_GL_SetSwapInterval(-1) != 0) {
-		std::cerr << "NOTE: couldn't set vsync + late swap tearing (" << SDL_GetError() << ")." << std::endl;
-		if (SDL_GL_SetSwapInterval(1) != 0) {
-			std::cerr << "NOTE: couldn't set vsync (" << SDL_GetError() << ")." << std::endl;
+	window_phase.end();
+
+	FramePacer pacer;
+	if (replay || uncapped) {
+		//replays run every frame back-to-back, so the frame-time profile
+		// measures the build rather than the display:
+		SDL_GL_SetSwapInterval(0);
+		pacer.set_mode(FramePacer::Uncapped);
+	} else if (fps_cap > 0.0f) {
+		//cap by sleeping instead of vsync-blocking in SwapWindow; see
+		// frame_pacer.hpp for why this is the battery-friendly option:
+		SDL_GL_SetSwapInterval(0);
+		pacer.set_mode(FramePacer::Capped, fps_cap);
+	} else {
+		//Set VSYNC + Late Swap (prevents crazy FPS):
+		if (SDL_GL_SetSwapInterval(-1) != 0) {
+			std::cerr << "NOTE: couldn't set vsync + late swap tearing (" << SDL_GetError() << ")." << std::endl;
+			if (SDL_GL_SetSwapInterval(1) != 0) {
+				std::cerr << "NOTE: couldn't set vsync (" << SDL_GetError() << ")." << std::endl;
+			}
 		}
+		pacer.set_mode(FramePacer::Vsync);
 	}
 
 	//Hide mouse cursor (note: showing can be useful for debugging):
@@ -89,7 +276,24 @@ int main(int argc, char **argv) {
 
 	//------------ create game object (loads assets) --------------
 
-	std::shared_ptr< Game > game = std::make_shared< Game >();
+	StartupPhase game_phase("game init (assets + gl)");
+	std::shared_ptr< Game > game = std::make_shared< Game >(
+		false, replay ? replay->seed : Game::DefaultSeed);
+	game_phase.end();
+
+	//how did launch time break down? (phases overlap; see startup_profiler.hpp)
+	startup_report();
+
+	//the second board in versus mode is simulation only -- it borrows the
+	// first Game's meshes, shader, and streaming buffer at draw time:
+	std::unique_ptr< GameState > state2;
+	if (versus) {
+		state2.reset(new GameState((replay ? replay->seed : Game::DefaultSeed) + 1));
+	}
+
+	//profiler tracks cpu time per loop stage + gpu time for draw:
+	// (created after the game so the GL context is known-good)
+	FrameProfiler profiler;
 
 	//------------ main loop ------------
 
@@ -109,44 +313,174 @@ int main(int argc, char **argv) {
 	};
 	on_resize();
 
-	//This will loop until the game object is set to null:
-	while (game) {
+	//fraction of a simulation tick elapsed since the last update, handed to
+	// draw() for interpolated rendering:
+	float tick_alpha = 1.0f;
+
+	//simulation ticks run so far (indexes the record/replay log):
+	std::atomic< uint32_t > sim_tick{0};
+
+	//batched input: events are drained into a frame-local buffer, folded into
+	// a snapshot in one pass, and the snapshot is handed to the simulation:
+	InputMapper mapper;
+	InputSnapshot input;
+	std::vector< SDL_Event > events;
+
+	//transient draw data (instance transform lists, HUD scratch) comes from
+	// this arena; it is reset once per frame, so nothing in the draw path
+	// touches malloc in the steady state:
+	FrameArena arena;
+
+	//---- the simulation thread ----
+	//update() runs on its own thread at the fixed tick rate and publishes an
+	// immutable DrawSnapshot after every tick through a wait-free slot, so
+	// this (the render) thread draws frame N while frame N+1 simulates --
+	// instead of the old serial loop that sat blocked in SwapWindow under
+	// vsync while update work queued up. SDL event pumping stays here (it
+	// must run on the thread that initialized video), and input edges are
+	// handed over through a small mutex-guarded accumulator so presses are
+	// never lost between frames.
+	//(replays skip the thread and tick inline: exactly one logged tick per
+	// rendered frame keeps playback faithful and reproducible.)
+	//both boards' snapshots publish together, so a versus frame never shows
+	// board 0 at tick N next to board 1 at tick N+1:
+	struct Snapshots {
+		Game::DrawSnapshot board[2];
+	};
+	SPSCSlot< Snapshots > snapshot_slot;
+	Snapshots current; //latest consumed snapshots (drawn every frame)
+	game->make_snapshot(&current.board[0]);
+	if (state2) state2->snapshot(&current.board[1]);
+
+	std::mutex input_mutex;
+	InputSnapshot shared_input; //edges accumulate until the sim thread takes them
+
+	std::atomic< bool > quit{false};
+	std::thread sim_thread;
+	if (!replay) {
+		sim_thread = std::thread([&](){
+			auto next = std::chrono::steady_clock::now();
+			auto const tick_duration = std::chrono::duration_cast< std::chrono::steady_clock::duration >(
+				std::chrono::duration< double >(Game::Tick));
+			while (!quit.load(std::memory_order_relaxed)) {
+				InputSnapshot in;
+				{ //take the accumulated input edges:
+					std::lock_guard< std::mutex > lock(input_mutex);
+					in = shared_input;
+					shared_input.clear_edges();
+				}
+				if (record) {
+					//the game only acts on press edges, so the edges are
+					// all the log needs:
+					record->record(sim_tick.load(std::memory_order_relaxed), in.pressed);
+				}
+				//board 0 reads the Left/Right bits; board 1 sees its own
+				// buttons (Left2/Right2) shifted down by for_player():
+				game->update(Game::Tick, in);
+				if (state2) state2->step(in.for_player(1));
+				sim_tick.fetch_add(1, std::memory_order_relaxed);
+
+				Snapshots &out = snapshot_slot.write_buffer();
+				game->make_snapshot(&out.board[0]);
+				if (state2) state2->snapshot(&out.board[1]);
+				snapshot_slot.publish();
+
+				//hold the fixed tick cadence (resync rather than spiral if
+				// something stalled the thread for a long time):
+				next += tick_duration;
+				auto now = std::chrono::steady_clock::now();
+				if (now > next + std::chrono::milliseconds(100)) {
+					next = now;
+				} else {
+					std::this_thread::sleep_until(next);
+				}
+			}
+		});
+	}
+
+	//This will loop until 'done' is set (quit requested or replay finished):
+	bool done = false;
+	while (!done) {
 		//every pass through the game loop creates one frame of output
 		//  by performing three steps:
 
 		{ //(1) process any events that are pending
-			static SDL_Event evt;
+			profiler.begin(FrameProfiler::Events);
+			//drain the whole queue into a frame-local buffer:
+			events.clear();
+			SDL_Event evt;
 			while (SDL_PollEvent(&evt) == 1) {
-				//handle resizing:
-				if (evt.type == SDL_WINDOWEVENT && evt.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+				events.push_back(evt);
+			}
+			//window management stays with the main loop:
+			for (auto const &e : events) {
+				if (e.type == SDL_WINDOWEVENT && e.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
 					on_resize();
+				} else if (e.type == SDL_QUIT) {
+					done = true;
 				}
-				//handle input:
-				if (game && game->handle_event(evt, window_size)) {
-					// mode handled it; great
-				} else if (evt.type == SDL_QUIT) {
-					game.reset(); //done: deallocate game
-					break;
-				}
 			}
-			if (!game) break;
+			//fold the batch into the input snapshot in one pass (replays
+			// ignore live input so they stay faithful):
+			if (!done && !replay) {
+				mapper.gather(events.data(), uint32_t(events.size()), &input);
+			}
+			profiler.end(FrameProfiler::Events);
+			if (done) break;
 		}
 
-		{ //(2) call the game's "update" function to deal with elapsed time:
-			auto current_time = std::chrono::high_resolution_clock::now();
-			static auto previous_time = current_time;
-			float elapsed = std::chrono::duration< float >(current_time - previous_time).count();
-			previous_time = current_time;
+		{ //(2) hand input to the simulation thread and fetch its latest snapshot:
+			profiler.begin(FrameProfiler::Update);
+			if (replay) {
+				//playback ignores wall time entirely: one logged tick per
+				// frame, every frame, until the log runs out:
+				uint32_t tick = sim_tick.load(std::memory_order_relaxed);
+				if (tick >= replay->tick_count) {
+					done = true; //replay finished
+				} else {
+					//logged control bits line up with the snapshot's button bits
+					// (both players' bits, so versus sessions replay whole):
+					input.clear_edges();
+					input.pressed = replay->controls_for(tick);
+					game->update(Game::Tick, input);
+					if (state2) state2->step(input.for_player(1));
+					sim_tick.store(tick + 1, std::memory_order_relaxed);
+					game->make_snapshot(&current.board[0]);
+					if (state2) state2->snapshot(&current.board[1]);
+				}
+				tick_alpha = 1.0f;
+			} else {
+				{ //merge this frame's input edges into the shared accumulator:
+					std::lock_guard< std::mutex > lock(input_mutex);
+					shared_input.held = input.held;
+					shared_input.pressed |= input.pressed;
+					shared_input.released |= input.released;
+				}
+				input.clear_edges();
 
-			//if frames are taking a very long time to process,
-			//lag to avoid spiral of death:
-			elapsed = std::min(0.1f, elapsed);
+				//adopt the newest published snapshot (keep drawing the old
+				// one when the sim thread hasn't finished a tick yet):
+				if (Snapshots const *latest = snapshot_slot.consume()) {
+					current = *latest;
+				}
+				//interpolation alpha: how far past the snapshot's tick we are:
+				float since = std::chrono::duration< float >(
+					std::chrono::high_resolution_clock::now() - current.board[0].tick_time).count();
+				tick_alpha = std::min(1.0f, std::max(0.0f, since / Game::Tick));
+			}
 
-			game->update(elapsed);
-			if (!game) break;
+			profiler.end(FrameProfiler::Update);
+			if (done) break;
 		}
 
 		{ //(3) call the game's "draw" function to produce output:
+			profiler.begin(FrameProfiler::Draw);
+			profiler.begin_gpu();
+
+			//pick up re-exported meshes.blob without restarting (throttled
+			// mtime check; patches only changed buffer ranges):
+			game->poll_reload();
+
 			//clear the depth+color buffers and set some default state:
 			glClearColor(0.5, 0.5, 0.5, 0.0);
 			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -154,16 +488,52 @@ int main(int argc, char **argv) {
 			glEnable(GL_BLEND);
 			glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-			game->draw(drawable_size);
+			//last frame's transient data is dead; reclaim it all at once:
+			arena.reset();
+
+			if (state2) {
+				//split screen: one Game draws both boards through the same
+				// meshes, shader, and streaming buffer, one viewport each:
+				glm::uvec2 half = glm::uvec2(drawable_size.x / 2, drawable_size.y);
+				game->draw(glm::ivec2(0, 0), half, tick_alpha, arena, current.board[0]);
+				game->draw(glm::ivec2(int(drawable_size.x) - int(half.x), 0), half, tick_alpha, arena, current.board[1]);
+			} else {
+				game->draw(drawable_size, tick_alpha, arena, current.board[0]);
+			}
+
+			profiler.end_gpu();
+			profiler.end(FrameProfiler::Draw);
 		}
 
 		//Finally, wait until the recently-drawn frame is shown before doing it all again:
+		profiler.begin(FrameProfiler::Swap);
 		SDL_GL_SwapWindow(window);
+		//in Capped mode, hold the target frame rate here (sleep + short spin);
+		// in Vsync/Uncapped modes this returns immediately:
+		pacer.pace();
+		profiler.end(FrameProfiler::Swap);
+
+		profiler.end_frame();
 	}
 
 
 	//------------  teardown ------------
 
+	//stop the simulation thread before anything it touches goes away:
+	quit.store(true, std::memory_order_relaxed);
+	if (sim_thread.joinable()) {
+		sim_thread.join();
+	}
+
+	if (record) {
+		record->close(sim_tick.load());
+	}
+
+	game.reset(); //frees GL resources, so the context must still be alive
+
+	profiler.dump_csv(data_path("frame-profile.csv"));
+	profiler.destroy(); //free GL queries while the context is still alive
+
 	SDL_GL_DeleteContext(context);
 	context = 0;
 
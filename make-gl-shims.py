@@ -1,11 +1,14 @@
 #!/usr/bin/env python3
 
 #create gl_shims.hpp by parsing everything from glcorearb.h (why not the regsistry xml, hmmmm?) and selecting only things that are core through version 3_3.
+#functions from later versions are also emitted, as DO_OPTIONAL() entries that
+#are bound when the driver provides them and left NULL otherwise (callers must check).
 
 import re
 
 protos = []
 extensions = []
+optionals = []
 
 with open('glcorearb.h', 'r') as f:
 	in_version = None
@@ -20,26 +23,35 @@ with open('glcorearb.h', 'r') as f:
 				protos.append("\n// " + in_version + " prototypes:\n")
 				do_proto = True
 				do_extension = False
+				do_optional = False
 			elif (major,minor) < (3,3):
 				extensions.append("\n// " + in_version + " extensions:\n")
 				do_proto = False
 				do_extension = True
+				do_optional = False
 			else:
+				optionals.append("\n// " + in_version + " optional extensions:\n")
 				do_proto = False
 				do_extension = False
+				do_optional = True
 		if in_version:
 			if do_proto:
 				m = re.match(r"^GLAPI ", line)
 				if m != None:
 					protos.append(line)
 				pass
-			if do_extension:
+			if do_extension or do_optional:
 			#	m = re.match(r".* PFNGL([^)]+)PROC\)", line)
-				m = re.match(r"GLAPI .* APIENTRY gl([^ ]+) \(", line)
+				#note: no space required before APIENTRY so pointer-returning
+				#functions (e.g. glMapBufferRange) are picked up too:
+				m = re.match(r"GLAPI .*APIENTRY gl([^ ]+) \(", line)
 				if m != None:
 					lc = m.group(1)
 					uc = lc.upper()
-					extensions.append("DO(" + uc + ", " + lc + ")\n")
+					if do_extension:
+						extensions.append("DO(" + uc + ", " + lc + ")\n")
+					else:
+						optionals.append("DO_OPTIONAL(" + uc + ", " + lc + ")\n")
 				pass
 			m = re.match(r"^#endif /\* " + in_version + " \*/$", line)
 			if m != None:
@@ -72,8 +84,14 @@ print("""
 	extern PFNGL ## TYPE ## PROC gl ## NAME;
 #endif
 
+#ifndef DO_OPTIONAL
+#define DO_OPTIONAL(TYPE, NAME) DO(TYPE, NAME)
+#endif
+
 """)
 
 print("".join(extensions))
 
+print("".join(optionals))
+
 print("#endif //GL_SHIMS_HPP")
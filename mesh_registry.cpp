@@ -0,0 +1,42 @@
+#include "mesh_registry.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+void MeshRegistry::add(std::string_view name, uint32_t first, uint32_t count) {
+	entries.push_back(Entry{mesh_name_hash(name), name, first, count});
+}
+
+void MeshRegistry::finish() {
+	std::sort(entries.begin(), entries.end(), [](Entry const &a, Entry const &b){
+		if (a.hash != b.hash) return a.hash < b.hash;
+		return a.name < b.name;
+	});
+	for (uint32_t i = 1; i < entries.size(); ++i) {
+		if (entries[i-1].name == entries[i].name) {
+			throw std::runtime_error("duplicate name in index.");
+		}
+	}
+}
+
+MeshRegistry::Entry const *MeshRegistry::maybe_lookup(std::string_view name) const {
+	MeshHandle hash = mesh_name_hash(name);
+	auto entry = std::lower_bound(entries.begin(), entries.end(), hash,
+		[](Entry const &e, MeshHandle h){ return e.hash < h; });
+	//hash collisions leave several entries with the same hash; compare names
+	// to land on the right one:
+	for (; entry != entries.end() && entry->hash == hash; ++entry) {
+		if (entry->name == name) return &*entry;
+	}
+	return nullptr;
+}
+
+MeshRegistry::Entry const &MeshRegistry::lookup(MeshHandle handle, std::string_view name) const {
+	auto entry = std::lower_bound(entries.begin(), entries.end(), handle,
+		[](Entry const &e, MeshHandle h){ return e.hash < h; });
+	for (; entry != entries.end() && entry->hash == handle; ++entry) {
+		if (entry->name == name) return *entry;
+	}
+	throw std::runtime_error("Mesh named '" + std::string(name) + "' does not appear in index.");
+}
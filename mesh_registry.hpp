@@ -0,0 +1,50 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+// MeshRegistry indexes the named meshes of a blob without copying anything:
+// each entry keeps a string_view into the blob's (mmapped) str0 chunk, and
+// the whole table lives in one sorted vector -- no per-name node or string
+// allocation, unlike the std::map this replaces. Lookups binary-search on a
+// 64-bit name hash; the hash function is constexpr, so the names a caller
+// knows at compile time become compile-time handles.
+//
+// Entries view storage owned by the caller (the mapped blob); the registry
+// must not outlive it.
+
+//FNV-1a; usable at compile time, e.g.:
+//  constexpr MeshHandle ShipMesh = mesh_name_hash("Ship");
+typedef uint64_t MeshHandle;
+constexpr MeshHandle mesh_name_hash(std::string_view name) {
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	for (char c : name) {
+		hash ^= uint8_t(c);
+		hash *= 0x100000001b3ULL;
+	}
+	return hash;
+}
+
+struct MeshRegistry {
+	struct Entry {
+		MeshHandle hash;
+		std::string_view name; //views into the blob; not owned
+		uint32_t first; //first vertex (or element, for indexed blobs)
+		uint32_t count;
+	};
+
+	//build by reserve() + add() for every blob index entry, then finish():
+	void reserve(uint32_t count) { entries.reserve(count); }
+	void add(std::string_view name, uint32_t first, uint32_t count);
+	void finish(); //sorts; throws std::runtime_error on duplicate names
+
+	//runtime query by name (hashes, then binary-searches); null on a miss:
+	Entry const *maybe_lookup(std::string_view name) const;
+
+	//query by precomputed handle; 'name' guards against hash collisions and
+	// appears in the error when the mesh is missing (throws on a miss):
+	Entry const &lookup(MeshHandle handle, std::string_view name) const;
+
+	std::vector< Entry > entries; //sorted by (hash, name) after finish()
+};
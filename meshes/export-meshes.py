@@ -3,7 +3,7 @@
 #based on 'export-sprites.py' and 'glsprite.py' from TCHOW Rainbow; code used is released into the public domain.
 
 #Note: Script meant to be executed from within blender, as per:
-#blender --background --python export-meshes.py -- <infile.blend> <outfile.blob>
+#blender --background --python export-meshes.py -- <infile.blend> <outfile.blob> [--indexed] [--quantized]
 
 import sys
 
@@ -12,8 +12,24 @@ for i in range(0,len(sys.argv)):
 	if sys.argv[i] == '--':
 		args = sys.argv[i+1:]
 
+#with --indexed, shared vertices are written once and an extra 'eidx' chunk of
+#uint32 element indices is emitted; the index chunk then stores element ranges:
+do_indexed = False
+if '--indexed' in args:
+	do_indexed = True
+	args.remove('--indexed')
+
+#with --quantized, vertex data is written as a 'dat1' chunk: a bounds header
+#(min/max as 6 floats) followed by 16-byte vertices -- positions as unorm16
+#within the bounds, normals packed 2_10_10_10, colors as before -- so the GPU
+#fetches 16 bytes per vertex instead of 28:
+do_quantized = False
+if '--quantized' in args:
+	do_quantized = True
+	args.remove('--quantized')
+
 if len(args) != 2:
-	print("\n\nUsage:\nblender --background --python export-meshes.py -- <infile.blend> <outfile.blob>\nExports the meshes referenced by all objects to a binary blob, indexed by the names of the objects that reference them.\n")
+	print("\n\nUsage:\nblender --background --python export-meshes.py -- <infile.blend> <outfile.blob> [--indexed] [--quantized]\nExports the meshes referenced by all objects to a binary blob, indexed by the names of the objects that reference them.\n")
 	exit(1)
 
 infile = args[0]
@@ -37,6 +53,9 @@ for obj in bpy.data.objects:
 #data contains vertex and normal data from the meshes:
 data = b''
 
+#elements contains uint32 indices into data (only written with --indexed):
+elements = b''
+
 #strings contains the mesh names:
 strings = b''
 
@@ -44,6 +63,9 @@ strings = b''
 index = b''
 
 vertex_count = 0
+element_count = 0
+seen_vertices = dict() #packed vertex bytes -> index into data (for --indexed)
+records = [] #float (pos, normal, color) tuples; quantized after the bounds are known
 for name in to_write:
 	print("Writing '" + name + "'...")
 	bpy.ops.object.mode_set(mode='OBJECT') #get out of edit mode (just in case)
@@ -76,8 +98,13 @@ for name in to_write:
 	index += struct.pack('I', name_begin)
 	index += struct.pack('I', name_end)
 
-	index += struct.pack('I', vertex_count)
-	index += struct.pack('I', vertex_count + len(mesh.polygons) * 3)
+	#ranges count elements with --indexed, expanded vertices otherwise:
+	if do_indexed:
+		index += struct.pack('I', element_count)
+		index += struct.pack('I', element_count + len(mesh.polygons) * 3)
+	else:
+		index += struct.pack('I', vertex_count)
+		index += struct.pack('I', vertex_count + len(mesh.polygons) * 3)
 
 	#With some inspiration from the game3 code
 	colors = obj.data.vertex_colors.active.data
@@ -96,31 +123,79 @@ for name in to_write:
 			assert(mesh.loops[poly.loop_indices[i]].vertex_index == poly.vertices[i])
 			loop = mesh.loops[poly.loop_indices[i]]
 			vertex = mesh.vertices[loop.vertex_index]
+			vertex_bytes = b''
 			for x in mesh.vertices[loop.vertex_index].co:
-				data += struct.pack('f', x)
+				vertex_bytes += struct.pack('f', x)
 			for x in loop.normal:
-				data += struct.pack('f', x)
+				vertex_bytes += struct.pack('f', x)
 			#With some inspiration from the game3 code
 			col = colors[poly.loop_indices[i]].color
-			data += struct.pack('BBBB', int(col.r * 255), int(col.g * 255), int(col.b * 255), 255)
+			vertex_bytes += struct.pack('BBBB', int(col.r * 255), int(col.g * 255), int(col.b * 255), 255)
 
 			if do_texcoord:
 				if uvs != None:
 					uv = uvs[poly.loop_indices[i]].uv
-					data += struct.pack('ff', uv.x, uv.y)
+					vertex_bytes += struct.pack('ff', uv.x, uv.y)
 				else:
-					data += struct.pack('ff', 0, 0)
-	vertex_count += len(mesh.polygons) * 3
+					vertex_bytes += struct.pack('ff', 0, 0)
+
+			#quantized vertices can't be packed until the global bounds are
+			#known, so stash the floats; dedup still keys on the float bytes:
+			record = (tuple(vertex.co), tuple(loop.normal), (int(col.r * 255), int(col.g * 255), int(col.b * 255), 255))
+
+			if do_indexed:
+				#write each distinct vertex once and refer to it by element index:
+				if vertex_bytes not in seen_vertices:
+					seen_vertices[vertex_bytes] = vertex_count
+					data += vertex_bytes
+					records.append(record)
+					vertex_count += 1
+				elements += struct.pack('I', seen_vertices[vertex_bytes])
+				element_count += 1
+			else:
+				data += vertex_bytes
+				records.append(record)
+				vertex_count += 1
 
 #check that we wrote as much data as anticipated:
 assert(vertex_count * (4*3+4*3+4*1) == len(data))
+assert(element_count * 4 == len(elements))
+
+if do_quantized:
+	#global position bounds over every vertex (per-chunk, so the runtime can
+	#dequantize with one scale/bias for the whole buffer):
+	bounds_min = [min(r[0][c] for r in records) for c in range(0,3)]
+	bounds_max = [max(r[0][c] for r in records) for c in range(0,3)]
+	#degenerate axes quantize to zero against a unit extent:
+	extent = [max(bounds_max[c] - bounds_min[c], 0.0) or 1.0 for c in range(0,3)]
+
+	def pack_snorm10(x):
+		#10-bit signed two's complement, as GL_INT_2_10_10_10_REV expects:
+		q = max(-511, min(511, int(round(max(-1.0, min(1.0, x)) * 511.0))))
+		return q & 0x3ff
+
+	data = b''
+	for (pos, normal, color) in records:
+		for c in range(0,3):
+			q = int(round((pos[c] - bounds_min[c]) / extent[c] * 65535.0))
+			data += struct.pack('H', max(0, min(65535, q)))
+		data += struct.pack('H', 0) #padding, so the packed normal stays 4-byte aligned
+		data += struct.pack('I', pack_snorm10(normal[0]) | (pack_snorm10(normal[1]) << 10) | (pack_snorm10(normal[2]) << 20))
+		data += struct.pack('BBBB', *color)
+	data = struct.pack('ffffff', *(bounds_min + bounds_max)) + data
+	assert(vertex_count * 16 + 24 == len(data))
 
 #write the data chunk and index chunk to an output blob:
 blob = open(outfile, 'wb')
 #first chunk: the data
-blob.write(struct.pack('4s',b'dat0')) #type
+blob.write(struct.pack('4s', b'dat1' if do_quantized else b'dat0')) #type
 blob.write(struct.pack('I', len(data))) #length
 blob.write(data)
+#optional chunk: the element indices
+if do_indexed:
+	blob.write(struct.pack('4s',b'eidx')) #type
+	blob.write(struct.pack('I', len(elements))) #length
+	blob.write(elements)
 #second chunk: the strings
 blob.write(struct.pack('4s',b'str0')) #type
 blob.write(struct.pack('I', len(strings))) #length
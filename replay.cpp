@@ -0,0 +1,72 @@
+#include "replay.hpp"
+
+#include <stdexcept>
+#include <cstring>
+
+static char const ReplayMagic[4] = {'r','p','l','0'};
+
+ReplayWriter::ReplayWriter(std::string const &path, uint32_t seed) {
+	file.open(path, std::ios::binary);
+	if (!file) {
+		throw std::runtime_error("Failed to open replay log '" + path + "' for writing.");
+	}
+	uint32_t tick_count = 0; //placeholder; patched by close()
+	file.write(ReplayMagic, 4);
+	file.write(reinterpret_cast< char const * >(&seed), sizeof(seed));
+	file.write(reinterpret_cast< char const * >(&tick_count), sizeof(tick_count));
+}
+
+ReplayWriter::~ReplayWriter() {
+	if (file.is_open()) {
+		close(0); //close() was never called; record an empty session length
+	}
+}
+
+void ReplayWriter::record(uint32_t tick, uint8_t controls) {
+	if (controls == 0) return; //ticks without input are implicit
+	file.write(reinterpret_cast< char const * >(&tick), sizeof(tick));
+	file.write(reinterpret_cast< char const * >(&controls), sizeof(controls));
+}
+
+void ReplayWriter::close(uint32_t tick_count) {
+	file.seekp(4 + sizeof(uint32_t)); //skip magic + seed
+	file.write(reinterpret_cast< char const * >(&tick_count), sizeof(tick_count));
+	file.close();
+}
+
+ReplayReader::ReplayReader(std::string const &path) {
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		throw std::runtime_error("Failed to open replay log '" + path + "'.");
+	}
+
+	char magic[4];
+	if (!file.read(magic, 4) || 0 != memcmp(magic, ReplayMagic, 4)) {
+		throw std::runtime_error("Replay log '" + path + "' has the wrong magic.");
+	}
+	if (!file.read(reinterpret_cast< char * >(&seed), sizeof(seed))
+	 || !file.read(reinterpret_cast< char * >(&tick_count), sizeof(tick_count))) {
+		throw std::runtime_error("Replay log '" + path + "' has a truncated header.");
+	}
+
+	Entry entry;
+	uint32_t previous = 0;
+	while (file.read(reinterpret_cast< char * >(&entry.tick), sizeof(entry.tick))
+	    && file.read(reinterpret_cast< char * >(&entry.controls), sizeof(entry.controls))) {
+		if (entry.tick >= tick_count || (!entries.empty() && entry.tick <= previous)) {
+			throw std::runtime_error("Replay log '" + path + "' has out-of-order ticks.");
+		}
+		previous = entry.tick;
+		entries.push_back(entry);
+	}
+	if (file.gcount() != 0) {
+		throw std::runtime_error("Replay log '" + path + "' has a truncated entry.");
+	}
+}
+
+uint8_t ReplayReader::controls_for(uint32_t tick) {
+	if (next < entries.size() && entries[next].tick == tick) {
+		return entries[next++].controls;
+	}
+	return 0;
+}
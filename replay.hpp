@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <fstream>
+
+// Record/replay for the game's input stream. Because all simulation
+// randomness flows from Game's seeded mersenne twister (see spawn_row) and
+// the simulation runs at a fixed tick rate, a session is fully determined by
+// the RNG seed plus the per-tick control bits; the log stores exactly that.
+//
+// File layout (little-endian):
+//   char[4] magic "rpl0"
+//   u32 seed         -- passed to Game's constructor
+//   u32 tick_count   -- total ticks in the session (patched in close())
+//   then one 5-byte entry per tick with nonzero controls:
+//   u32 tick, u8 controls -- the tick's InputSnapshot::pressed bitset, so the
+//   bits follow InputSnapshot::Button for both players (bits 0/1 = player 1
+//   left/right, bits 2/3 = player 2; see input.hpp)
+
+//ReplayWriter streams entries to disk as the session runs:
+struct ReplayWriter {
+	//opens 'path' and writes the header (throws std::runtime_error on failure):
+	ReplayWriter(std::string const &path, uint32_t seed);
+	~ReplayWriter(); //close()s, if close() was not called explicitly
+
+	//called once per simulation tick, before Game::update consumes the
+	// controls; zero-control ticks are skipped in the file:
+	void record(uint32_t tick, uint8_t controls);
+
+	//patch the final tick count into the header and flush:
+	void close(uint32_t tick_count);
+
+	std::ofstream file;
+};
+
+//ReplayReader loads a whole log up front and hands back the control bits
+// for each tick in sequence:
+struct ReplayReader {
+	//reads and validates 'path' (throws std::runtime_error on failure):
+	ReplayReader(std::string const &path);
+
+	//control bits for tick 'tick'; ticks must be queried in increasing order:
+	uint8_t controls_for(uint32_t tick);
+
+	uint32_t seed = 0;
+	uint32_t tick_count = 0;
+
+	struct Entry {
+		uint32_t tick;
+		uint8_t controls;
+	};
+	std::vector< Entry > entries;
+	uint32_t next = 0; //cursor into entries, advanced by controls_for()
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// SPSCSlot<T> is a wait-free single-producer/single-consumer mailbox that
+// always holds the most recently published T. It triple-buffers: the
+// producer always has a free buffer to write into, the consumer's buffer
+// stays stable while it reads, and publish()/consume() are one atomic
+// exchange each -- no locks, no waiting on the other thread. Unconsumed
+// values are simply overwritten (latest wins), which is the behavior a
+// draw-snapshot handoff wants: the renderer only ever cares about the
+// newest simulation state.
+
+template< typename T >
+struct SPSCSlot {
+	//--- producer side ---
+
+	//buffer for the producer to fill; owned by the producer until publish():
+	T &write_buffer() { return buffers[write]; }
+
+	//hand the filled buffer to the consumer (and pick up a free one):
+	void publish() {
+		uint32_t prev = ready.exchange(write | Fresh, std::memory_order_acq_rel);
+		write = prev & IndexMask;
+	}
+
+	//--- consumer side ---
+
+	//newest published value, or nullptr when nothing new arrived since the
+	// last consume(); the returned pointer stays valid until the next call:
+	T const *consume() {
+		if (!(ready.load(std::memory_order_acquire) & Fresh)) return nullptr;
+		//the producer never clears Fresh, so whatever we swap out here is
+		// still a published buffer (possibly even newer than the one peeked):
+		uint32_t prev = ready.exchange(read, std::memory_order_acq_rel);
+		read = prev & IndexMask;
+		return &buffers[read];
+	}
+
+	enum : uint32_t {
+		IndexMask = 0x3,
+		Fresh = 0x4, //set when 'ready' holds a not-yet-consumed publish
+	};
+
+	T buffers[3];
+	uint32_t write = 0; //producer-owned
+	uint32_t read = 2; //consumer-owned
+	std::atomic< uint32_t > ready{1}; //middle buffer, not fresh
+};
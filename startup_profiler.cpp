@@ -0,0 +1,55 @@
+#include "startup_profiler.hpp"
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+#include <cstdio>
+
+//phases are recorded into a process-wide table; a mutex guards the table
+// because init work runs on worker threads, but each phase is touched only
+// twice (begin/end), so contention is irrelevant:
+namespace {
+	struct Phase {
+		char const *name;
+		std::chrono::steady_clock::time_point begin;
+		std::chrono::steady_clock::time_point end;
+	};
+	std::mutex mutex;
+	std::vector< Phase > phases;
+
+	//time zero for the report's offset column; captured as early as static
+	// init runs, which is close enough to process start:
+	std::chrono::steady_clock::time_point const t0 = std::chrono::steady_clock::now();
+}
+
+StartupPhase::StartupPhase(char const *name) {
+	std::lock_guard< std::mutex > lock(mutex);
+	index = (unsigned int)phases.size();
+	phases.emplace_back(Phase{name, std::chrono::steady_clock::now(), std::chrono::steady_clock::time_point()});
+}
+
+StartupPhase::~StartupPhase() {
+	if (!ended) end();
+}
+
+void StartupPhase::end() {
+	std::lock_guard< std::mutex > lock(mutex);
+	phases[index].end = std::chrono::steady_clock::now();
+	ended = true;
+}
+
+void startup_report() {
+	std::lock_guard< std::mutex > lock(mutex);
+	auto ms = [](std::chrono::steady_clock::time_point a, std::chrono::steady_clock::time_point b) {
+		return std::chrono::duration< double, std::milli >(b - a).count();
+	};
+	printf("startup phases (ms from launch; phases on worker threads overlap):\n");
+	printf("  %-28s %9s %9s %9s\n", "phase", "begin", "end", "took");
+	for (auto const &phase : phases) {
+		if (phase.end == std::chrono::steady_clock::time_point()) {
+			printf("  %-28s %9.2f %9s %9s\n", phase.name, ms(t0, phase.begin), "-", "(open)");
+		} else {
+			printf("  %-28s %9.2f %9.2f %9.2f\n", phase.name, ms(t0, phase.begin), ms(t0, phase.end), ms(phase.begin, phase.end));
+		}
+	}
+}
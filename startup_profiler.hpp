@@ -0,0 +1,26 @@
+#pragma once
+
+// Startup instrumentation: scoped timers around each init phase, printed as
+// a small table once the window is up. Phases may overlap (init runs work on
+// worker threads), so the table shows begin/end offsets from process start
+// rather than pretending the phases form a stack. All of it is cheap enough
+// to leave on in shipping builds.
+//
+// Usage:
+//   { StartupPhase phase("shader compile+link"); ...work... }
+//   ...
+//   startup_report(); //print the table (main calls this once after init)
+
+//RAII scope for one phase; safe to construct on any thread. When a phase
+// can't live in its own block (e.g. it produces variables the rest of the
+// function needs), call end() explicitly; the destructor then does nothing:
+struct StartupPhase {
+	StartupPhase(char const *name);
+	~StartupPhase();
+	void end();
+	unsigned int index; //into the module's phase table
+	bool ended = false;
+};
+
+//print every recorded phase (ms offsets from process start) to stdout:
+void startup_report();
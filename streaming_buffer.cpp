@@ -0,0 +1,98 @@
+#include "streaming_buffer.hpp"
+#include "gl_extensions.hpp"
+
+#include <iostream>
+
+StreamingBuffer::~StreamingBuffer() {
+	destroy();
+}
+
+void StreamingBuffer::create(size_t region_size_) {
+	destroy();
+	region_size = region_size_;
+
+	glGenBuffers(1, &buffer);
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+
+	persistent = have_gl_extension("GL_ARB_buffer_storage");
+	#ifdef _WIN32
+	//the shims bind post-3.3 entry points optionally, so double-check them:
+	persistent = persistent && glBufferStorage && glMapBufferRange && glFenceSync;
+	#endif
+
+	if (persistent) {
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage(GL_ARRAY_BUFFER, RegionCount * region_size, nullptr, flags);
+		mapped = reinterpret_cast< uint8_t * >(glMapBufferRange(GL_ARRAY_BUFFER, 0, RegionCount * region_size, flags));
+		if (!mapped) {
+			std::cerr << "WARNING: persistent mapping failed; falling back to orphaned uploads." << std::endl;
+			persistent = false;
+		}
+	}
+	if (!persistent) {
+		glBufferData(GL_ARRAY_BUFFER, region_size, nullptr, GL_STREAM_DRAW);
+		staging.resize(region_size);
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void StreamingBuffer::destroy() {
+	for (uint32_t r = 0; r < RegionCount; ++r) {
+		if (fences[r]) {
+			glDeleteSync(fences[r]);
+			fences[r] = nullptr;
+		}
+	}
+	if (mapped) {
+		glBindBuffer(GL_ARRAY_BUFFER, buffer);
+		glUnmapBuffer(GL_ARRAY_BUFFER);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		mapped = nullptr;
+	}
+	if (buffer != -1U) {
+		glDeleteBuffers(1, &buffer);
+		buffer = -1U;
+	}
+	staging.clear();
+	region = 0;
+	region_size = 0;
+	persistent = false;
+}
+
+void *StreamingBuffer::begin_frame() {
+	if (!persistent) return staging.data();
+
+	if (fences[region]) {
+		//the GPU last read this region three frames ago, so the fence is
+		// almost certainly already signalled and this returns immediately:
+		GLenum ret = glClientWaitSync(fences[region], GL_SYNC_FLUSH_COMMANDS_BIT, GLuint64(1000000000));
+		if (ret == GL_TIMEOUT_EXPIRED || ret == GL_WAIT_FAILED) {
+			std::cerr << "WARNING: waited a very long time for streaming buffer region " << region << "." << std::endl;
+		}
+		glDeleteSync(fences[region]);
+		fences[region] = nullptr;
+	}
+	return mapped + region * region_size;
+}
+
+void StreamingBuffer::flush() {
+	if (persistent) return; //coherent mapping: writes are already visible
+
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	//orphan the old storage so this upload never waits on in-flight draws:
+	glBufferData(GL_ARRAY_BUFFER, region_size, nullptr, GL_STREAM_DRAW);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, region_size, staging.data());
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void StreamingBuffer::end_frame() {
+	if (!persistent) return; //orphaning already avoids any overwrite hazard
+
+	fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	region = (region + 1) % RegionCount;
+}
+
+size_t StreamingBuffer::offset() const {
+	return persistent ? region * region_size : 0;
+}
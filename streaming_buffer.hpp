@@ -0,0 +1,60 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+//StreamingBuffer manages a GL buffer whose contents are re-written every frame
+// (e.g. per-instance transforms for Game::draw).
+//
+//When GL_ARB_buffer_storage is available, the buffer is created with
+// glBufferStorage and persistently + coherently mapped as a ring of three
+// regions; a fence per region keeps the CPU from overwriting data the GPU is
+// still reading, and writes go straight into driver-visible memory.
+//Otherwise it falls back to a CPU staging copy uploaded with orphan-and-fill
+// glBufferData, which never blocks either (at the cost of one extra copy).
+//
+//Usage, once per frame:
+//	void *data = stream.begin_frame(); //write up to region_size bytes here
+//	stream.flush();                    //call after writing, before drawing
+//	//...bind stream.buffer, point attributes at stream.offset(), draw...
+//	stream.end_frame();                //call after all draws using the data
+
+struct StreamingBuffer {
+	StreamingBuffer() = default;
+	~StreamingBuffer();
+
+	//create GL-side storage (three regions of region_size bytes each):
+	void create(size_t region_size);
+	//free GL-side storage (safe to call on an empty buffer):
+	void destroy();
+
+	//get a pointer to region_size writable bytes for this frame; waits
+	// (almost never, given three regions) if the GPU still reads the region:
+	void *begin_frame();
+
+	//make this frame's writes visible to the GPU; no-op when persistently
+	// mapped, an orphan-and-fill upload on the fallback path:
+	void flush();
+
+	//call after all draw calls that read this frame's data; fences the
+	// region and advances the ring:
+	void end_frame();
+
+	//byte offset of the region currently being written, for attribute pointers:
+	size_t offset() const;
+
+	enum : uint32_t { RegionCount = 3 };
+
+	GLuint buffer = -1U;
+	size_t region_size = 0;
+	uint32_t region = 0; //which of the three regions is being written
+
+	bool persistent = false; //true when glBufferStorage + persistent mapping is in use
+	uint8_t *mapped = nullptr; //persistent path: base of the whole mapping
+	GLsync fences[RegionCount] = {nullptr, nullptr, nullptr}; //persistent path: per-region fences
+
+	std::vector< uint8_t > staging; //fallback path: CPU-side copy of one region
+};